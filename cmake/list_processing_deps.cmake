@@ -10,4 +10,5 @@ find_package(CMakeUtilities)
 
 find_package(type_utility REQUIRED)
 find_package(function_utility REQUIRED)
+find_package(Threads REQUIRED)
 # find_package(ctstring REQUIRED)
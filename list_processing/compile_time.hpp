@@ -4,8 +4,10 @@
 // ... List Processing header files
 //
 #include <list_processing/compile_time/Cell.hpp>
+#include <list_processing/compile_time/FlatList.hpp>
 #include <list_processing/compile_time/Nothing.hpp>
 #include <list_processing/compile_time/Queue.hpp>
+#include <list_processing/compile_time/Sort.hpp>
 #include <list_processing/compile_time/Stack.hpp>
 #include <list_processing/compile_time/Tape.hpp>
 #include <list_processing/compile_time/Tree.hpp>
@@ -17,22 +19,37 @@ namespace ListProcessing::CompileTime {
 
   using Details::buildList;
   using Details::cons;
+  using Details::FlatList;
+  using Details::flatList;
+  using Details::FlatListType;
   using Details::length_;
   using Details::list;
   using Details::ListType;
   using Details::Nothing;
   using Details::nothing;
+  using Details::toFlatList;
 
+  using Details::empty_flat_stack;
   using Details::empty_stack;
+  using Details::make_flat_stack;
   using Details::make_stack;
 
+  using Details::empty_flat_tape;
   using Details::empty_tape;
+  using Details::makeFlatTape;
   using Details::makeTape;
 
+  using Details::empty_flat_queue;
   using Details::empty_queue;
+  using Details::makeFlatQueue;
   using Details::makeQueue;
 
   using Details::empty_tree;
   using Details::tree;
 
+  using Details::groupBy;
+  using Details::partition;
+  using Details::sortBy;
+  using Details::unique;
+
 } // end of namespace ListProcessing::CompileTime
@@ -4,6 +4,7 @@
 // ... List Processing header files
 //
 #include <list_processing/compile_time/Cell.hpp>
+#include <list_processing/compile_time/FlatList.hpp>
 #include <list_processing/compile_time/Nothing.hpp>
 #include <list_processing/compile_time/import.hpp>
 
@@ -12,13 +13,90 @@ namespace ListProcessing::CompileTime::Details {
   template<typename T>
   class AList;
 
+  /**
+   * @brief An index of the key types of an alist
+   *
+   * @details The position of a key type is found by scanning a constant
+   * array of type comparisons.  The index of a flat alist is read
+   * directly from its type, and a flat alist reads the value at that
+   * position in one step, so a lookup in a flat alist instantiates a
+   * constant number of templates, however many keys there are.  The index
+   * of an alist of cells extends the index of its tail by one key, and
+   * reaching the value walks the cells before it, so both recurse once
+   * per association, as the lookups in cells always have; tables with
+   * many keys should be built with `flatAList`.
+   */
+  template<typename... Ks>
+  struct KeyIndex
+  {
+    static constexpr size_type size = sizeof...(Ks);
+
+    template<typename K>
+    using push_front = KeyIndex<K, Ks...>;
+
+    /**
+     * @brief The position of the first occurrence of the input key type,
+     * or `size` if the key type does not occur.
+     */
+    template<typename U>
+    static constexpr size_type position = [] {
+      constexpr bool matches[] = {is_same_v<U, Ks>..., false};
+      size_type i = 0;
+      while (i < size && !matches[i]) {
+        ++i;
+      }
+      return i;
+    }();
+
+    template<typename U>
+    static constexpr bool contains = position<U> < size;
+  };
+
+  template<typename Data>
+  struct KeyIndexOf;
+
+  template<>
+  struct KeyIndexOf<Nothing>
+  {
+    using type = KeyIndex<>;
+  };
+
   template<typename K, typename V, typename Tail>
-  class AList<Cell<pair<K, V>, Tail>>
+  struct KeyIndexOf<Cell<pair<K, V>, Tail>>
+  {
+    using type = typename KeyIndexOf<Tail>::type::template push_front<K>;
+  };
+
+  template<typename... Ks, typename... Vs>
+  struct KeyIndexOf<FlatList<pair<Ks, Vs>...>>
   {
-    using DataType = Cell<pair<K, V>, Tail>;
+    using type = KeyIndex<Ks...>;
+  };
+
+  template<NonEmptyListType L>
+  class AList<L>
+  {
+    using DataType = L;
+    using Index = typename KeyIndexOf<DataType>::type;
+    using K = typename decay_t<decltype(head(declval<L>()))>::first_type;
+    using Tail = decay_t<decltype(tail(declval<L>()))>;
 
     DataType data;
 
+    template<typename U>
+    static constexpr bool has_key = Index::template contains<decay_t<U>>;
+
+    /**
+     * @brief Return the value of the first association with the input
+     * key type.
+     */
+    template<typename U>
+    constexpr auto const&
+    valueOf() const
+    {
+      return data.at(nat<Index::template position<decay_t<U>>>).second;
+    }
+
   public:
     constexpr AList() = delete;
     constexpr AList(DataType const& input)
@@ -104,21 +182,15 @@ namespace ListProcessing::CompileTime::Details {
     // | ' \/ _` (_-< ' </ -_) || |
     // |_||_\__,_/__/_|\_\___|\_, |
     //                        |__/
-    constexpr bool
-    hasKey(K const&) const
-    {
-      return true;
-    }
-
     template<typename T>
     constexpr bool
-    hasKey(T const& key) const
+    hasKey(T const&) const
     {
-      return AList<Tail>(tail(data)).hasKey(key);
+      return has_key<T>;
     }
 
     template<typename T>
-    friend bool
+    friend constexpr bool
     hasKey(T const& key, AList const& xs)
     {
       return xs.hasKey(key);
@@ -129,18 +201,15 @@ namespace ListProcessing::CompileTime::Details {
     // |  _/ _ \ '_/ _/ -_) (_ / -_)  _|
     // |_| \___/_| \__\___|\___\___|\__|
 
-    template<typename T>
-    constexpr auto
-    forceGet(K const&, T const&) const
-    {
-      return head(data).second;
-    }
-
     template<typename U, typename T>
     constexpr auto
-    forceGet(U const& key, T const& alternative) const
+    forceGet(U const&, T const& alternative) const
     {
-      return AList<Tail>(tail(data)).forceGet(key, alternative);
+      if constexpr (has_key<U>) {
+        return valueOf<U>();
+      } else {
+        return alternative;
+      }
     }
 
     template<typename U, typename T>
@@ -155,17 +224,12 @@ namespace ListProcessing::CompileTime::Details {
     // |  _| '_| || | (_ / -_)  _|
     //  \__|_|  \_, |\___\___|\__|
     //          |__/
-    constexpr auto
-    tryGet(K const&) const
-    {
-      return head(data).second;
-    }
-
     template<typename U>
     constexpr auto
-    tryGet(U const& key) const
+    tryGet(U const&) const
     {
-      return AList<Tail>(tail(data)).tryGet(key);
+      static_assert(has_key<U>, "AList does not have requested key!");
+      return valueOf<U>();
     }
 
     template<typename U>
@@ -264,19 +328,19 @@ namespace ListProcessing::CompileTime::Details {
       return os;
     }
 
-  }; // end of class AList<Cell<pair<K,V>, Tail>>
+  }; // end of class AList<L>, for nonempty L
 
-  template<>
-  class AList<Nothing>
+  template<EmptyListType L>
+  class AList<L>
   {
-    using DataType = Nothing;
+    using DataType = L;
 
     DataType data;
 
   public:
     constexpr AList(){};
-    constexpr AList(Nothing const&){};
-    constexpr AList(Nothing&&){};
+    constexpr AList(L const&){};
+    constexpr AList(L&&){};
 
     //          _
     //  ___ ___| |_
@@ -286,8 +350,8 @@ namespace ListProcessing::CompileTime::Details {
     constexpr auto
     set(K const& key, V const& value) const
     {
-      using NewDataType = Cell<pair<K, V>, Nothing>;
-      return AList<NewDataType>(cons(pair(key, value), nothing));
+      using NewDataType = decltype(cons(pair(key, value), data));
+      return AList<NewDataType>(cons(pair(key, value), data));
     }
 
     template<typename K, typename V>
@@ -446,11 +510,14 @@ namespace ListProcessing::CompileTime::Details {
       return os << "empty_alist";
     }
 
-  }; // end of class AList<Nothing>
+  }; // end of class AList<L>, for empty L
 
   template<typename K, typename V, typename Tail>
   AList(Cell<pair<K, V>, Tail>) -> AList<Cell<pair<K, V>, Tail>>;
 
+  template<typename... Ks, typename... Vs>
+  AList(FlatList<pair<Ks, Vs>...>) -> AList<FlatList<pair<Ks, Vs>...>>;
+
   template<typename T>
   concept EmbelishedType = !is_same_v<T, decay_t<T>>;
 
@@ -469,17 +536,11 @@ namespace ListProcessing::CompileTime::Details {
   struct HasKeyByType<K, Table> : HasKeyByType<K, decay_t<Table>>
   {};
 
-  template<typename U>
-  struct HasKeyByType<U, AList<Nothing>> : false_type
-  {};
-
-  template<typename K, typename V, typename Tail>
-  struct HasKeyByType<K, AList<Cell<pair<K, V>, Tail>>> : true_type
-  {};
-
-  template<typename U, typename K, typename V, typename Tail>
-  struct HasKeyByType<U, AList<Cell<pair<K, V>, Tail>>>
-    : HasKeyByType<U, AList<Tail>>
+  template<typename U, typename Data>
+  struct HasKeyByType<U, AList<Data>>
+    : integral_constant<
+        bool,
+        KeyIndexOf<Data>::type::template contains<U>>
   {};
 
   template<typename K, typename Table>
@@ -494,4 +555,16 @@ namespace ListProcessing::CompileTime::Details {
     return AList(list(std::forward<Ts>(xs)...));
   }
 
+  constexpr AList<FlatList<>> empty_flat_alist{};
+
+  /**
+   * @brief Return an alist of the input associations, with flat storage
+   */
+  template<typename... Ts>
+  constexpr auto
+  flatAList(Ts const&... xs)
+  {
+    return AList(flatList(xs...));
+  }
+
 } // end of namespace ListProcessing::CompileTime::Details
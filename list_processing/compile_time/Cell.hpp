@@ -347,6 +347,24 @@ namespace ListProcessing::CompileTime::Details {
       return xs.listRef(nat<N>);
     }
 
+    /**
+     * @brief Return a reference to the element at the input index,
+     * without copying the cells before it.
+     *
+     * @details This recurses once per cell before the element; use a
+     * `FlatList` for positional access in constant depth.
+     */
+    template<size_t N>
+    constexpr auto const&
+    at(Nat<N>) const
+    {
+      if constexpr (N == 0) {
+        return base::first;
+      } else {
+        return base::second.at(nat<N - 1>);
+      }
+    }
+
     constexpr auto
     take(Nat<0>) const
     {
@@ -533,66 +551,18 @@ namespace ListProcessing::CompileTime::Details {
       return filterAux(pred, xs, nothing);
     }
 
-    template<typename Cmp, typename V>
-    struct PartialRelation
-    {
-      template<typename W>
-      constexpr bool
-      operator()(W const&) const
-      {
-        return Cmp{}(V{}, W{});
-      }
-    };
-
-    template<typename Cmp, typename V>
-    struct NegatePartialRelation
-    {
-      template<typename W>
-      constexpr bool
-      operator()(W const&) const
-      {
-        constexpr bool result = !(Cmp{}(V{}, W{}));
-        return result;
-      }
-    };
-
-    template<typename Cmp>
-    static constexpr Nothing
-    sortAux(Cmp const&, Nothing)
-    {
-      return nothing;
-    }
-
-    template<typename Cmp, typename V>
-    static constexpr Cell<V, Nothing>
-    sortAux(Cmp const&, Cell<V, Nothing> const& xs)
-    {
-      return xs;
-    }
-
-    template<typename Cmp, typename V, typename W>
-    static constexpr auto
-    sortAux(Cmp const& cmp, Cell<V, W> const& xs)
-    {
-      return cons(
-               xs.head(),
-               sortAux(cmp, xs.tail().filter(PartialRelation<Cmp, V>{})))
-        .append(
-          sortAux(cmp, xs.tail().filter(NegatePartialRelation<Cmp, V>{})));
-    }
-
     template<typename F>
     constexpr auto
     sort(F const& cmp) const
     {
-      return sortAux(cmp, *this);
+      return sortList(cmp, *this);
     }
 
     template<typename F>
     friend constexpr auto
     sort(F const& cmp, Cell const& xs)
     {
-      return sortAux(cmp, xs);
+      return sortList(cmp, xs);
     }
 
     template<typename F>
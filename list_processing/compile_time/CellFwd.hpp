@@ -13,6 +13,21 @@ namespace ListProcessing::CompileTime::Details {
   template<typename T, typename U>
   Cell(T&& x, U&& y) -> Cell<decay_t<T>, decay_t<U>>;
 
+  template<typename... Ts>
+  class FlatList;
+
+  template<typename Cmp, typename T>
+  constexpr auto
+  sortList(Cmp const& cmp, T const& xs);
+
+  template<typename T>
+  struct IsFlatList : false_type
+  {};
+
+  template<typename... Ts>
+  struct IsFlatList<FlatList<Ts...>> : true_type
+  {};
+
   class Cons : public Static_curried<Cons, Nat<2>>
   {
   public:
@@ -20,7 +35,11 @@ namespace ListProcessing::CompileTime::Details {
     static constexpr auto
     call(T&& x, U&& y)
     {
-      return Cell(std::forward<T>(x), std::forward<U>(y));
+      if constexpr (IsFlatList<decay_t<U>>::value) {
+        return y.cons(std::forward<T>(x));
+      } else {
+        return Cell(std::forward<T>(x), std::forward<U>(y));
+      }
     }
   } constexpr cons{};
 
@@ -0,0 +1,459 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/compile_time/Cell.hpp>
+#include <list_processing/compile_time/CellFwd.hpp>
+#include <list_processing/compile_time/Nothing.hpp>
+#include <list_processing/compile_time/import.hpp>
+
+namespace ListProcessing::CompileTime::Details {
+
+  template<size_t I, typename T>
+  struct FlatLeaf
+  {
+    T value;
+  };
+
+  template<size_t I, typename T>
+  constexpr T const&
+  leafRef(FlatLeaf<I, T> const& leaf)
+  {
+    return leaf.value;
+  }
+
+  template<typename Indices, typename... Ts>
+  struct FlatStorage;
+
+  /**
+   * @brief The elements of a flat list, each in a base class tagged with
+   * its index, so that an element is reached by a single conversion to
+   * its base rather than by recursion.
+   */
+  template<size_t... Is, typename... Ts>
+  struct FlatStorage<index_sequence<Is...>, Ts...> : FlatLeaf<Is, Ts>...
+  {
+    constexpr FlatStorage(Ts const&... xs)
+      : FlatLeaf<Is, Ts>{xs}...
+    {}
+  };
+
+  /**
+   * @brief A heterogeneous list with flat storage
+   *
+   * @details A `FlatList` has the interface of the lists built from
+   * `Cell`s, and may be used with `Stack`, `Queue`, `Tape` and `AList`,
+   * but its elements are stored side by side in one aggregate rather than
+   * in nested pairs.  Its type is not nested, indexing it instantiates a
+   * constant number of templates, and `at` returns a reference to an
+   * element without copying the elements before it.  Operations that
+   * change the shape of the list, such as `cons` and `tail`, copy the
+   * elements into a new flat list.
+   */
+  template<typename... Ts>
+  class FlatList
+  {
+    using Storage = FlatStorage<make_index_sequence<sizeof...(Ts)>, Ts...>;
+
+    Storage data;
+
+    template<typename... Us>
+    friend class FlatList;
+
+    template<size_t N>
+    using ElementType = decay_t<decltype(leafRef<N>(declval<Storage>()))>;
+
+    template<size_t Offset, size_t... Is>
+    constexpr auto
+    slice(index_sequence<Is...>) const
+    {
+      return FlatList<ElementType<Offset + Is>...>(at(nat<Offset + Is>)...);
+    }
+
+  public:
+    static constexpr size_type size = sizeof...(Ts);
+
+    constexpr explicit(sizeof...(Ts) == 1) FlatList(Ts const&... xs)
+      : data(xs...)
+    {}
+
+    /**
+     * @brief Return a reference to the element at the input index
+     */
+    template<size_t N>
+    constexpr auto const&
+    at(Nat<N>) const
+    {
+      static_assert(N < sizeof...(Ts), "FlatList index out of range");
+      return leafRef<N>(data);
+    }
+
+    template<size_t N>
+    constexpr auto
+    listRef(Nat<N>) const
+    {
+      return at(nat<N>);
+    }
+
+    template<size_t N>
+    friend constexpr auto
+    listRef(Nat<N>, FlatList const& xs)
+    {
+      return xs.at(nat<N>);
+    }
+
+    constexpr auto
+    head() const
+    {
+      return at(nat<0>);
+    }
+
+    friend constexpr auto
+    head(FlatList const& xs)
+    {
+      return xs.head();
+    }
+
+    constexpr auto
+    tail() const
+    {
+      if constexpr (size == 0) {
+        return *this;
+      } else {
+        return slice<1>(make_index_sequence<size - 1>());
+      }
+    }
+
+    friend constexpr auto
+    tail(FlatList const& xs)
+    {
+      return xs.tail();
+    }
+
+    template<typename V>
+    constexpr auto
+    cons(V const& x) const
+    {
+      return [&]<size_t... Is>(index_sequence<Is...>) {
+        return FlatList<V, Ts...>(x, at(nat<Is>)...);
+      }(make_index_sequence<size>());
+    }
+
+    constexpr bool
+    isNull() const
+    {
+      return size == 0;
+    }
+
+    friend constexpr bool
+    isNull(FlatList const& xs)
+    {
+      return xs.isNull();
+    }
+
+    constexpr bool
+    isEmpty() const
+    {
+      return size == 0;
+    }
+
+    friend constexpr bool
+    isEmpty(FlatList const& xs)
+    {
+      return xs.isEmpty();
+    }
+
+    constexpr bool
+    hasData() const
+    {
+      return size != 0;
+    }
+
+    friend constexpr bool
+    hasData(FlatList const& xs)
+    {
+      return xs.hasData();
+    }
+
+    constexpr size_type
+    length() const
+    {
+      return size;
+    }
+
+    friend constexpr size_type
+    length(FlatList const& xs)
+    {
+      return xs.length();
+    }
+
+    template<size_t N>
+    constexpr auto
+    take(Nat<N>) const
+    {
+      constexpr size_t n = N < size ? N : size;
+      return slice<0>(make_index_sequence<n>());
+    }
+
+    template<size_t N>
+    friend constexpr auto
+    take(Nat<N>, FlatList const& xs)
+    {
+      return xs.take(nat<N>);
+    }
+
+    template<size_t N>
+    constexpr auto
+    drop(Nat<N>) const
+    {
+      constexpr size_t n = N < size ? N : size;
+      return slice<n>(make_index_sequence<size - n>());
+    }
+
+    template<size_t N>
+    friend constexpr auto
+    drop(Nat<N>, FlatList const& xs)
+    {
+      return xs.drop(nat<N>);
+    }
+
+    constexpr auto
+    reverse() const
+    {
+      return [&]<size_t... Is>(index_sequence<Is...>) {
+        return FlatList<ElementType<size - 1 - Is>...>(
+          at(nat<size - 1 - Is>)...);
+      }(make_index_sequence<size>());
+    }
+
+    friend constexpr auto
+    reverse(FlatList const& xs)
+    {
+      return xs.reverse();
+    }
+
+    /**
+     * @brief Return the elements of the input list followed by the
+     * elements of this list, as `Cell::append` does.
+     */
+    template<typename... Us>
+    constexpr auto
+    append(FlatList<Us...> const& xs) const
+    {
+      return [&]<size_t... Is, size_t... Js>(
+               index_sequence<Is...>, index_sequence<Js...>) {
+        return FlatList<Us..., Ts...>(xs.at(nat<Is>)..., at(nat<Js>)...);
+      }(make_index_sequence<sizeof...(Us)>(), make_index_sequence<size>());
+    }
+
+    template<typename... Us>
+    friend constexpr auto
+    append(FlatList const& xs, FlatList<Us...> const& ys)
+    {
+      return ys.append(xs);
+    }
+
+    template<size_t I, typename F, typename V>
+    constexpr auto
+    foldlFrom(F f, V const& accum) const
+    {
+      if constexpr (I == size) {
+        return accum;
+      } else {
+        return foldlFrom<I + 1>(f, f(accum, at(nat<I>)));
+      }
+    }
+
+    template<typename F, typename V>
+    constexpr auto
+    foldl(F f, V const& init) const
+    {
+      return foldlFrom<0>(f, init);
+    }
+
+    template<typename F, typename V>
+    friend constexpr auto
+    foldl(F f, V const& init, FlatList const& xs)
+    {
+      return xs.foldl(f, init);
+    }
+
+    template<typename F>
+    constexpr auto
+    mapList(F f) const
+    {
+      return [&]<size_t... Is>(index_sequence<Is...>) {
+        return FlatList<decay_t<decltype(f(at(nat<Is>)))>...>(
+          f(at(nat<Is>))...);
+      }(make_index_sequence<size>());
+    }
+
+    template<typename F>
+    friend constexpr auto
+    mapList(F f, FlatList const& xs)
+    {
+      return xs.mapList(f);
+    }
+
+    /**
+     * @brief Call the input function with the elements of this list
+     */
+    template<typename F>
+    constexpr auto
+    applyList(F const& f) const
+    {
+      return [&]<size_t... Is>(index_sequence<Is...>) {
+        return f(at(nat<Is>)...);
+      }(make_index_sequence<size>());
+    }
+
+    template<typename F>
+    friend constexpr auto
+    applyList(F const& f, FlatList const& xs)
+    {
+      return xs.applyList(f);
+    }
+
+    template<typename F>
+    constexpr auto
+    sort(F const& cmp) const
+    {
+      return sortList(cmp, *this);
+    }
+
+    template<typename F>
+    friend constexpr auto
+    sort(F const& cmp, FlatList const& xs)
+    {
+      return sortList(cmp, xs);
+    }
+
+    template<typename F>
+    friend void
+    doList(FlatList const& xs, F f)
+    {
+      [&]<size_t... Is>(index_sequence<Is...>) {
+        (f(xs.at(nat<Is>)), ...);
+      }(make_index_sequence<size>());
+    }
+
+    template<typename... Us>
+    friend constexpr bool
+    operator==(FlatList const& xs, FlatList<Us...> const& ys)
+    {
+      if constexpr (sizeof...(Us) != size) {
+        return false;
+      } else {
+        return [&]<size_t... Is>(index_sequence<Is...>) {
+          return ((xs.at(nat<Is>) == ys.at(nat<Is>)) && ...);
+        }(make_index_sequence<size>());
+      }
+    }
+
+    template<typename V>
+    friend constexpr bool
+    operator==(FlatList const&, V const&)
+    {
+      return false;
+    }
+
+    template<typename V>
+    friend constexpr bool
+    operator!=(FlatList const& xs, V const& ys)
+    {
+      return !(xs == ys);
+    }
+
+    template<typename Stream>
+    Stream&
+    printList(Stream& os) const
+    {
+      os << '(';
+      [&]<size_t... Is>(index_sequence<Is...>) {
+        ((os << (Is == 0 ? "" : " ") << at(nat<Is>)), ...);
+      }(make_index_sequence<size>());
+      os << ')';
+      return os;
+    }
+
+    template<typename Stream>
+    friend Stream&
+    operator<<(Stream& os, FlatList const& xs)
+    {
+      return xs.printList(os);
+    }
+
+    // This concrete stream type implementation
+    // is to disambiguate the ostream operators when
+    // using gtest.
+    friend ostream&
+    operator<<(ostream& os, FlatList const& xs)
+    {
+      return xs.printList(os);
+    }
+
+  }; // end of class FlatList
+
+  template<typename... Ts>
+  FlatList(Ts const&...) -> FlatList<Ts...>;
+
+  template<typename... Ts>
+  constexpr size_type
+  length_(Type<FlatList<Ts...>>)
+  {
+    return sizeof...(Ts);
+  }
+
+  template<typename... Ts>
+  constexpr bool
+  isListType(Type<FlatList<Ts...>>)
+  {
+    return true;
+  }
+
+  template<typename... Ts>
+  struct IsList<FlatList<Ts...>> : true_type
+  {};
+
+  /**
+   * @brief A list type with no elements
+   */
+  template<typename L>
+  concept EmptyListType = isListType(type<L>) && length_(type<L>) == 0;
+
+  /**
+   * @brief A list type with at least one element
+   */
+  template<typename L>
+  concept NonEmptyListType = isListType(type<L>) && length_(type<L>) > 0;
+
+  class MakeFlatList : public Static_callable<MakeFlatList>
+  {
+  public:
+    template<typename... Ts>
+    static constexpr auto
+    call(Ts const&... xs)
+    {
+      return FlatList<Ts...>(xs...);
+    }
+  } constexpr flatList{};
+
+  /**
+   * @brief Return a flat list with the elements of the input list
+   */
+  class ToFlatList : public Static_curried<ToFlatList, Nat<1>>
+  {
+  public:
+    template<typename T>
+    static constexpr auto
+    call(T const& xs)
+    {
+      return applyList(flatList, xs);
+    }
+  } constexpr toFlatList{};
+
+  template<typename... Ts>
+  using FlatListType = FlatList<decay_t<Ts>...>;
+
+} // end of namespace ListProcessing::CompileTime::Details
@@ -4,6 +4,7 @@
 // ... List Processing header files
 //
 #include <list_processing/compile_time/Cell.hpp>
+#include <list_processing/compile_time/FlatList.hpp>
 #include <list_processing/compile_time/Nothing.hpp>
 
 namespace ListProcessing::CompileTime::Details {
@@ -69,9 +70,9 @@ namespace ListProcessing::CompileTime::Details {
     pop() const
     {
       if constexpr (length_(type<O>) == 0) {
-        return constructQueue(nil, nil);
+        return *this;
       } else if constexpr (length_(type<O>) == 1) {
-        return constructQueue(nil, reverse(input));
+        return constructQueue(tail(output), reverse(input));
       } else {
         return constructQueue(input, tail(output));
       }
@@ -88,7 +89,7 @@ namespace ListProcessing::CompileTime::Details {
     push(T const& x) const
     {
       if constexpr (length_(type<O>) == 0) {
-        return constructQueue(nil, list(x));
+        return constructQueue(input, cons(x, output));
       } else {
         return constructQueue(cons(x, input), output);
       }
@@ -113,6 +114,21 @@ namespace ListProcessing::CompileTime::Details {
       return xs.rot();
     }
 
+    /**
+     * @brief Return a list of the elements of this queue, from the front
+     */
+    constexpr auto
+    toList() const
+    {
+      return append(output, reverse(input));
+    }
+
+    friend constexpr auto
+    toList(Queue const& xs)
+    {
+      return xs.toList();
+    }
+
     template<typename Stream>
     friend Stream&
     operator<<(Stream& os, Queue const& xs)
@@ -159,4 +175,16 @@ namespace ListProcessing::CompileTime::Details {
     return Queue(nil, list(x, xs...));
   }
 
+  constexpr Queue<FlatList<>, FlatList<>> empty_flat_queue{{}, {}};
+
+  /**
+   * @brief Return a queue of the input values, with flat storage
+   */
+  template<typename T, typename... Ts>
+  constexpr auto
+  makeFlatQueue(T const& x, Ts const&... xs)
+  {
+    return Queue(FlatList<>{}, flatList(x, xs...));
+  }
+
 } // end of namespace ListProcessing::CompileTime::Details
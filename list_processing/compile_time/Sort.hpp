@@ -0,0 +1,295 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/compile_time/Cell.hpp>
+#include <list_processing/compile_time/CellFwd.hpp>
+#include <list_processing/compile_time/FlatList.hpp>
+#include <list_processing/compile_time/import.hpp>
+
+namespace ListProcessing::CompileTime::Details {
+
+  /**
+   * @brief The key of an element of type `E` under a key function of
+   * type `F`
+   *
+   * @details The order of a heterogeneous list is part of its type, so
+   * the keys used to rearrange one can depend only on the types of its
+   * elements.  As with the predicates of `filter`, a key function is
+   * stateless, and it is called with a value-initialized element: with
+   * `type<T>` for the elements of a type list, with `nat<N>` for the
+   * elements of a list of naturals, and so on.
+   */
+  template<typename F, typename E>
+  constexpr auto keyOf = F{}(E{});
+
+  /**
+   * @brief Return the function that makes a list of the same kind as a
+   * list of the input type.
+   */
+  template<typename L>
+  constexpr auto
+  listMaker(Type<L>)
+  {
+    if constexpr (IsFlatList<L>::value) {
+      return flatList;
+    } else {
+      return list;
+    }
+  }
+
+  /**
+   * @brief Return a list made with the input function from the elements
+   * of a flat list at the input indices.
+   */
+  template<auto Indices, typename Make, typename... Es>
+  constexpr auto
+  pick(Make make, FlatList<Es...> const& ys)
+  {
+    return [&]<size_t... Is>(index_sequence<Is...>) {
+      return make(ys.at(nat<Indices[Is]>)...);
+    }(make_index_sequence<Indices.size()>());
+  }
+
+  /**
+   * @brief Return the indices at which the input flags are set
+   */
+  template<auto Flags>
+  constexpr auto
+  selectedIndices()
+  {
+    constexpr size_t m = [] {
+      size_t count = 0;
+      for (bool flag : Flags) {
+        count += flag;
+      }
+      return count;
+    }();
+    array<size_t, m> result{};
+    size_t j = 0;
+    for (size_t i = 0; i < Flags.size(); ++i) {
+      if (Flags[i]) {
+        result[j++] = i;
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief The permutation that stably sorts elements of the input types
+   * by a stateless comparison of type `Cmp`
+   *
+   * @details Each pair of element types is compared once, and the
+   * permutation is computed by a bottom up merge sort over an array of
+   * indices during constant evaluation, so sorting a list of any length
+   * instantiates a constant depth of templates.
+   */
+  template<typename Cmp, typename... Es>
+  struct SortPermutation
+  {
+    static constexpr size_t n = sizeof...(Es);
+
+    template<typename E>
+    static constexpr array<bool, n> row{bool(Cmp{}(E{}, Es{}))...};
+
+    static constexpr array<array<bool, n>, n> less{row<Es>...};
+
+    static constexpr array<size_t, n> value = [] {
+      array<size_t, n> perm{};
+      for (size_t i = 0; i < n; ++i) {
+        perm[i] = i;
+      }
+      array<size_t, n> merged{};
+      for (size_t width = 1; width < n; width *= 2) {
+        for (size_t lo = 0; lo < n; lo += 2 * width) {
+          size_t mid = lo + width < n ? lo + width : n;
+          size_t hi = lo + 2 * width < n ? lo + 2 * width : n;
+          size_t i = lo, j = mid, k = lo;
+          while (i < mid && j < hi) {
+            merged[k++] = less[perm[j]][perm[i]] ? perm[j++] : perm[i++];
+          }
+          while (i < mid) {
+            merged[k++] = perm[i++];
+          }
+          while (j < hi) {
+            merged[k++] = perm[j++];
+          }
+        }
+        perm = merged;
+      }
+      return perm;
+    }();
+  };
+
+  template<typename Cmp, typename Make, typename... Es>
+  constexpr auto
+  sortAux(Make make, FlatList<Es...> const& ys)
+  {
+    return pick<SortPermutation<Cmp, Es...>::value>(make, ys);
+  }
+
+  template<typename Cmp, typename T>
+  constexpr auto
+  sortList(Cmp const&, T const& xs)
+  {
+    return sortAux<Cmp>(listMaker(type<T>), toFlatList(xs));
+  }
+
+  /**
+   * @brief The comparison of elements by their keys
+   */
+  template<typename F>
+  struct KeyLess
+  {
+    template<typename A, typename B>
+    constexpr bool
+    operator()(A const&, B const&) const
+    {
+      return keyOf<F, A> < keyOf<F, B>;
+    }
+  };
+
+  /**
+   * @brief The index of the first element with an equal key, for each
+   * element of the input types
+   *
+   * @details Keys are only compared for equality, so they need not have a
+   * common type: `type<T> == type<U>` is enough to group a type list.
+   */
+  template<typename F, typename... Es>
+  struct KeyClasses
+  {
+    template<typename E>
+    static constexpr size_t
+    classOf()
+    {
+      constexpr array<bool, sizeof...(Es)> same{
+        (keyOf<F, E> == keyOf<F, Es>)...};
+      size_t i = 0;
+      while (!same[i]) {
+        ++i;
+      }
+      return i;
+    }
+
+    static constexpr array<size_t, sizeof...(Es)> value{classOf<Es>()...};
+
+    static constexpr array<bool, sizeof...(Es)> leaders = [] {
+      array<bool, sizeof...(Es)> result{};
+      for (size_t i = 0; i < sizeof...(Es); ++i) {
+        result[i] = value[i] == i;
+      }
+      return result;
+    }();
+
+    template<size_t Leader>
+    static constexpr array<bool, sizeof...(Es)> members = [] {
+      array<bool, sizeof...(Es)> result{};
+      for (size_t i = 0; i < sizeof...(Es); ++i) {
+        result[i] = value[i] == Leader;
+      }
+      return result;
+    }();
+  };
+
+  /**
+   * @brief Return a list with the elements of the input list stably
+   * sorted by the input key function.
+   */
+  class SortBy : public Static_curried<SortBy, Nat<2>>
+  {
+  public:
+    template<typename F, typename T>
+    static constexpr auto
+    call(F const&, T const& xs)
+    {
+      return sortList(KeyLess<F>{}, xs);
+    }
+  } constexpr sortBy{};
+
+  /**
+   * @brief Return a list with the first element of the input list with
+   * each key, in their original order.
+   */
+  class Unique : public Static_curried<Unique, Nat<2>>
+  {
+  public:
+    template<typename F, typename T>
+    static constexpr auto
+    call(F const&, T const& xs)
+    {
+      return aux<F>(listMaker(type<T>), toFlatList(xs));
+    }
+
+  private:
+    template<typename F, typename Make, typename... Es>
+    static constexpr auto
+    aux(Make make, FlatList<Es...> const& ys)
+    {
+      constexpr auto kept = selectedIndices<KeyClasses<F, Es...>::leaders>();
+      return pick<kept>(make, ys);
+    }
+  } constexpr unique{};
+
+  /**
+   * @brief Return a pair with the elements of the input list that satisfy
+   * the input predicate, and the elements that do not, each in their
+   * original order.
+   */
+  class Partition : public Static_curried<Partition, Nat<2>>
+  {
+  public:
+    template<typename F, typename T>
+    static constexpr auto
+    call(F const&, T const& xs)
+    {
+      return aux<F>(listMaker(type<T>), toFlatList(xs));
+    }
+
+  private:
+    template<typename F, typename Make, typename... Es>
+    static constexpr auto
+    aux(Make make, FlatList<Es...> const& ys)
+    {
+      constexpr array<bool, sizeof...(Es)> selected{bool(keyOf<F, Es>)...};
+      constexpr array<bool, sizeof...(Es)> rejected{!bool(keyOf<F, Es>)...};
+      return pair(
+        pick<selectedIndices<selected>()>(make, ys),
+        pick<selectedIndices<rejected>()>(make, ys));
+    }
+  } constexpr partition{};
+
+  /**
+   * @brief Return a list of lists of the elements of the input list with
+   * equal keys.
+   *
+   * @details The groups are ordered by the first occurrence of their keys,
+   * and the elements of each group keep their original order.
+   */
+  class GroupBy : public Static_curried<GroupBy, Nat<2>>
+  {
+  public:
+    template<typename F, typename T>
+    static constexpr auto
+    call(F const&, T const& xs)
+    {
+      return aux<F>(listMaker(type<T>), toFlatList(xs));
+    }
+
+  private:
+    template<typename F, typename Make, typename... Es>
+    static constexpr auto
+    aux(Make make, FlatList<Es...> const& ys)
+    {
+      using Classes = KeyClasses<F, Es...>;
+      constexpr auto leaders = selectedIndices<Classes::leaders>();
+      return [&]<size_t... Gs>(index_sequence<Gs...>) {
+        return make(pick<selectedIndices<
+                           Classes::template members<leaders[Gs]>>()>(
+          make, ys)...);
+      }(make_index_sequence<leaders.size()>());
+    }
+  } constexpr groupBy{};
+
+} // end of namespace ListProcessing::CompileTime::Details
@@ -4,6 +4,7 @@
 // ... List Processing header files
 //
 #include <list_processing/compile_time/Cell.hpp>
+#include <list_processing/compile_time/FlatList.hpp>
 #include <list_processing/compile_time/Nothing.hpp>
 #include <list_processing/compile_time/import.hpp>
 
@@ -15,6 +16,9 @@ namespace ListProcessing::CompileTime::Details {
   template<typename T, typename U>
   Stack(Cell<T, U> const& xs) -> Stack<Cell<T, U>>;
 
+  template<typename... Ts>
+  Stack(FlatList<Ts...> const& xs) -> Stack<FlatList<Ts...>>;
+
   class ListToStack : public Static_curried<ListToStack, Nat<1>>
   {
   public:
@@ -26,14 +30,14 @@ namespace ListProcessing::CompileTime::Details {
     }
   } constexpr listToStack{};
 
-  template<>
-  class Stack<Nothing>
+  template<EmptyListType L>
+  class Stack<L>
   {
-    using DataType = Nothing;
+    using DataType = L;
 
   public:
     constexpr Stack(){};
-    constexpr Stack(Nothing const&){};
+    constexpr Stack(L const&){};
 
   private:
     DataType data;
@@ -43,11 +47,11 @@ namespace ListProcessing::CompileTime::Details {
     constexpr auto
     push(T const& x) const
     {
-      return listToStack(cons(x, nothing));
+      return listToStack(cons(x, data));
     }
 
     template<typename T>
-    friend constexpr Stack<Cell<T, Nothing>>
+    friend constexpr auto
     push(T const& x, Stack const& xs)
     {
       return xs.push(x);
@@ -107,6 +111,13 @@ namespace ListProcessing::CompileTime::Details {
       return true;
     }
 
+    template<EmptyListType M>
+    friend constexpr bool
+    operator==(Stack const&, Stack<M> const&)
+    {
+      return true;
+    }
+
     template<typename T>
     friend constexpr bool
     operator==(Stack const&, T const&)
@@ -121,6 +132,18 @@ namespace ListProcessing::CompileTime::Details {
       return false;
     }
 
+    constexpr DataType
+    toList() const
+    {
+      return data;
+    }
+
+    friend constexpr DataType
+    toList(Stack const& xs)
+    {
+      return xs.toList();
+    }
+
     template<typename Stream>
     friend Stream&
     operator<<(Stream& os, Stack const&)
@@ -139,15 +162,13 @@ namespace ListProcessing::CompileTime::Details {
 
   constexpr Stack<Nothing> empty_stack{};
 
-  template<typename T, typename U>
-  class Stack<Cell<T, U>>
+  template<NonEmptyListType L>
+  class Stack<L>
   {
-    static_assert(isListType(type<U>));
-
   public:
-    using Data = Cell<T, U>;
-    using TopType = T;
-    using PopType = U;
+    using Data = L;
+    using TopType = decay_t<decltype(head(declval<L>()))>;
+    using PopType = decay_t<decltype(tail(declval<L>()))>;
 
     constexpr Stack(Data const& xs)
       : data(xs)
@@ -158,17 +179,17 @@ namespace ListProcessing::CompileTime::Details {
 
   public:
     template<typename V>
-    constexpr Stack<Cell<V, Data>>
+    constexpr auto
     push(V const& x) const
     {
-      return {cons(x, data)};
+      return listToStack(cons(x, data));
     }
 
     template<typename V>
-    friend constexpr Stack<Cell<V, Data>>
+    friend constexpr auto
     push(V const& x, Stack const& xs)
     {
-      xs.push(x);
+      return xs.push(x);
     }
 
     constexpr bool
@@ -323,14 +344,16 @@ namespace ListProcessing::CompileTime::Details {
       return false;
     }
 
+    template<EmptyListType M>
     friend constexpr bool
-    operator==(Stack const&, Stack<Nothing> const&)
+    operator==(Stack const&, Stack<M> const&)
     {
       return false;
     }
 
+    template<EmptyListType M>
     friend constexpr bool
-    operator==(Stack<Nothing> const&, Stack const&)
+    operator==(Stack<M> const&, Stack const&)
     {
       return false;
     }
@@ -342,6 +365,21 @@ namespace ListProcessing::CompileTime::Details {
       return !(xs == ys);
     }
 
+    /**
+     * @brief Return a list of the elements of this stack, from the top
+     */
+    constexpr Data
+    toList() const
+    {
+      return data;
+    }
+
+    friend constexpr Data
+    toList(Stack const& xs)
+    {
+      return xs.toList();
+    }
+
     template<typename Stream>
     friend Stream&
     operator<<(Stream& os, Stack const& xs)
@@ -368,4 +406,16 @@ namespace ListProcessing::CompileTime::Details {
     return Stack(list(x, xs...));
   }
 
+  /**
+   * @brief Return a stack of the input values, with flat storage
+   */
+  template<typename T, typename... Ts>
+  constexpr auto
+  make_flat_stack(T const& x, Ts const&... xs)
+  {
+    return Stack(flatList(x, xs...));
+  }
+
+  constexpr Stack<FlatList<>> empty_flat_stack{};
+
 } // end of namespace ListProcessing::CompileTime::Details
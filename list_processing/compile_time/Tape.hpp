@@ -4,6 +4,7 @@
 // ... List Processing header files
 //
 #include <list_processing/compile_time/Cell.hpp>
+#include <list_processing/compile_time/FlatList.hpp>
 #include <list_processing/compile_time/Nothing.hpp>
 #include <list_processing/compile_time/import.hpp>
 
@@ -312,4 +313,16 @@ namespace ListProcessing::CompileTime::Details {
     return Tape(list(x, xs...), nil);
   }
 
+  constexpr Tape<FlatList<>, FlatList<>> empty_flat_tape{{}, {}};
+
+  /**
+   * @brief Return a tape of the input values, with flat storage
+   */
+  template<typename T, typename... Ts>
+  constexpr auto
+  makeFlatTape(T const& x, Ts const&... xs)
+  {
+    return Tape(flatList(x, xs...), FlatList<>{});
+  }
+
 } // end of namespace ListProcessing::CompileTime::Details
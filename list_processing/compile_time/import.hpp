@@ -3,6 +3,7 @@
 //
 // ... Standard header files
 //
+#include <array>
 #include <cstddef>
 #include <iostream>
 #include <type_traits>
@@ -20,10 +21,14 @@ namespace ListProcessing::CompileTime::Details {
   using index_type = integer;
   using offset_type = integer;
 
+  using std::array;
   using std::declval;
   using std::forward;
+  using std::index_sequence;
+  using std::make_index_sequence;
   using std::pair;
 
+  using std::common_type_t;
   using std::conditional_t;
   using std::decay_t;
   using std::enable_if_t;
@@ -9,5 +9,7 @@ namespace ListProcessing::CompileTime {
   using Details::alist;
   using Details::AList;
   using Details::empty_alist;
+  using Details::empty_flat_alist;
+  using Details::flatAList;
   using Details::hasKeyByType;
 } // end of namespace ListProcessing::CompileTime
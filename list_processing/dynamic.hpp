@@ -5,7 +5,11 @@
 //
 
 #include <list_processing/dynamic_alist.hpp>
+#include <list_processing/dynamic_atom.hpp>
+#include <list_processing/dynamic_hash_table.hpp>
 #include <list_processing/dynamic_list.hpp>
+#include <list_processing/dynamic_ordered_map.hpp>
+#include <list_processing/dynamic_parallel.hpp>
 #include <list_processing/dynamic_queue.hpp>
 #include <list_processing/dynamic_shared_list.hpp>
 #include <list_processing/dynamic_stack.hpp>
@@ -16,8 +16,8 @@ namespace ListProcessing::Dynamic::Details {
     using assoc_type = pair<K, T>;
     using data_type = ListType<assoc_type>;
 
-    AList()
-      : data(nil<assoc_type>)
+    constexpr AList()
+      : data()
     {}
 
     AList(data_type input_data)
@@ -65,7 +65,7 @@ namespace ListProcessing::Dynamic::Details {
     AList
     unset(K key)
     {
-      return AList(data_type(unsetAux(key, data_type::nil, data)));
+      return AList(unsetAux(key, data));
     }
 
     /**
@@ -75,21 +75,27 @@ namespace ListProcessing::Dynamic::Details {
     friend AList
     unset(K key, AList xs)
     {
-      return AList(data_type(unsetAux(key, data_type::nil, xs.data)));
+      return AList(unsetAux(key, xs.data));
     }
 
   private:
-    static Trampoline<data_type>
-    unsetAux(K key, data_type accum, data_type xs)
+    static data_type
+    unsetAux(K const& key, data_type const& xs)
     {
-      using tramp = Trampoline<data_type>;
-      return xs.hasData()
-               ? (head(xs).first == key
-                    ? tramp(rappend(accum, tail(xs)))
-                    : tramp([=] {
-                        return unsetAux(key, cons(head(xs), accum), tail(xs));
-                      }))
-               : tramp(reverse(accum));
+      // Only the associations before the first match are copied, and
+      // the rest of the list is shared.
+      vector<assoc_type const*> prefix{};
+      for (data_type rest = xs; rest.hasData(); rest = rest.tail()) {
+        if (rest.head().first == key) {
+          data_type result = rest.tail();
+          for (auto x = prefix.rbegin(); x != prefix.rend(); ++x) {
+            result = cons(**x, result);
+          }
+          return result;
+        }
+        prefix.push_back(&rest.head());
+      }
+      return xs;
     }
 
     //  _ _ ___ _ __  _____ _____
@@ -103,7 +109,7 @@ namespace ListProcessing::Dynamic::Details {
     AList
     remove(K key) const
     {
-      return AList(data_type(removeAux(key, data_type::nil, data)));
+      return AList(removeAux(key, data));
     }
 
     /**
@@ -113,21 +119,35 @@ namespace ListProcessing::Dynamic::Details {
     friend AList
     remove(K key, AList xs)
     {
-      return AList(data_type(removeAux(key, data_type::nil, xs.data)));
+      return AList(removeAux(key, xs.data));
     }
 
   private:
-    static Trampoline<data_type>
-    removeAux(K key, data_type accum, data_type xs)
+    static data_type
+    removeAux(K const& key, data_type const& xs)
     {
-      using tramp = Trampoline<data_type>;
-      return xs.hasData()
-               ? (head(xs).first == key
-                    ? tramp([=] { return removeAux(key, accum, tail(xs)); })
-                    : tramp([=] {
-                        return removeAux(key, cons(head(xs), accum), tail(xs));
-                      }))
-               : tramp(reverse(accum));
+      vector<assoc_type const*> kept{};
+      doList(xs, [&](assoc_type const& x) {
+        if (!(x.first == key)) {
+          kept.push_back(&x);
+        }
+      });
+      data_type result = data_type::nil;
+      for (auto x = kept.rbegin(); x != kept.rend(); ++x) {
+        result = cons(**x, result);
+      }
+      return result;
+    }
+
+    /**
+     * @brief Return a pointer to the first association with the input
+     * key, or a null pointer if there is none.
+     */
+    static assoc_type const*
+    find(K const& key, data_type const& xs)
+    {
+      return findFirst(
+        xs, [&](assoc_type const& x) { return x.first == key; });
     }
 
     //  _            _  __
@@ -143,7 +163,7 @@ namespace ListProcessing::Dynamic::Details {
     bool
     hasKey(K key) const
     {
-      return bool(hasKeyAux(key, data));
+      return find(key, data) != nullptr;
     }
 
     /**
@@ -153,18 +173,7 @@ namespace ListProcessing::Dynamic::Details {
     friend bool
     hasKey(K key, AList xs)
     {
-      return bool(hasKeyAux(key, xs.data));
-    }
-
-  private:
-    static Trampoline<bool>
-    hasKeyAux(K key, data_type xs)
-    {
-      using tramp = Trampoline<bool>;
-      return xs.hasData() ? (head(xs).first == key ? tramp(true) : tramp([=] {
-        return hasKeyAux(key, tail(xs));
-      }))
-                          : tramp(false);
+      return find(key, xs.data) != nullptr;
     }
 
     //   __                 ___     _
@@ -180,7 +189,8 @@ namespace ListProcessing::Dynamic::Details {
     T
     forceGet(K const& key, T const& alternate) const&
     {
-      return T(forceGetAux(key, alternate, data));
+      assoc_type const* x = find(key, data);
+      return x ? x->second : alternate;
     }
 
     /**
@@ -194,18 +204,6 @@ namespace ListProcessing::Dynamic::Details {
       return xs.forceGet(key, alternate);
     }
 
-  private:
-    static Trampoline<T>
-    forceGetAux(K const& key, T const& alternate, data_type const& xs)
-    {
-      using tramp = Trampoline<T>;
-      return xs.hasData()
-               ? (head(xs).first == key ? tramp(head(xs).second) : tramp([=] {
-                   return forceGetAux(key, alternate, tail(xs));
-                 }))
-               : tramp(alternate);
-    }
-
   public:
     //                  _          ___     _
     //  _ __  __ _ _  _| |__  ___ / __|___| |_
@@ -220,7 +218,8 @@ namespace ListProcessing::Dynamic::Details {
     optional<T>
     maybeGet(K key) const
     {
-      return optional<T>(maybeGetAux(key, data));
+      assoc_type const* x = find(key, data);
+      return x ? optional<T>(x->second) : nullopt;
     }
 
     /**
@@ -230,19 +229,7 @@ namespace ListProcessing::Dynamic::Details {
     friend optional<T>
     maybeGet(K key, AList xs)
     {
-      return optional<T>(maybeGetAux(key, xs.data));
-    }
-
-  private:
-    static Trampoline<optional<T>>
-    maybeGetAux(K key, data_type xs)
-    {
-      using tramp = Trampoline<optional<T>>;
-      return xs.hasData()
-               ? (head(xs).first == key ? tramp(head(xs).second) : tramp([=] {
-                   return maybeGetAux(key, tail(xs));
-                 }))
-               : tramp(optional<T>{nullopt});
+      return xs.maybeGet(key);
     }
 
   public:
@@ -255,28 +242,20 @@ namespace ListProcessing::Dynamic::Details {
     T
     tryGet(K key) const
     {
-      return T(tryGetAux(key, data));
+      assoc_type const* x = find(key, data);
+      if (!x) {
+        throw logic_error(
+          "\n" __FILE__ ":" + std::to_string(__LINE__) +
+          ":0 "
+          "AList does not have requested key!\n");
+      }
+      return x->second;
     }
 
     friend T
     tryGet(K key, AList xs)
     {
-      return T(tryGetAux(key, xs.data));
-    }
-
-  private:
-    static Trampoline<T>
-    tryGetAux(K key, data_type xs)
-    {
-      using tramp = Trampoline<T>;
-      return xs.hasData()
-               ? (head(xs).first == key ? tramp(head(xs).second) : tramp([=] {
-                   return tryGetAux(key, tail(xs));
-                 }))
-               : throw logic_error(
-                   "\n" __FILE__ ":" + std::to_string(__LINE__) +
-                   ":0 "
-                   "AList does not have requested key!\n");
+      return xs.tryGet(key);
     }
 
   private:
@@ -319,7 +298,7 @@ namespace ListProcessing::Dynamic::Details {
     auto
     keys() const
     {
-      return map([](auto pr) { return pr.first; }, data);
+      return map([](assoc_type const& pr) { return pr.first; }, data);
     }
 
     friend auto
@@ -332,7 +311,7 @@ namespace ListProcessing::Dynamic::Details {
     auto
     vals() const
     {
-      return map([](auto pr) { return pr.second; }, data);
+      return map([](assoc_type const& pr) { return pr.second; }, data);
     }
 
     friend auto
@@ -357,7 +336,7 @@ namespace ListProcessing::Dynamic::Details {
   }; // end of class AList
 
   template<typename K, typename T>
-  const AList<K, T> empty_alist{};
+  constinit const AList<K, T> empty_alist{};
 
   template<typename... Ks, typename... Vs>
   auto
@@ -0,0 +1,465 @@
+#pragma once
+
+//
+// ... Standard header files
+//
+#include <span>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/AList.hpp>
+#include <list_processing/dynamic/HashTable.hpp>
+#include <list_processing/dynamic/List.hpp>
+#include <list_processing/dynamic/import.hpp>
+
+namespace ListProcessing::Dynamic::Details {
+
+  /**
+   * @brief An association list that indexes itself by hash once it grows
+   *
+   * @details While it has at most `Threshold` associations, the list is a
+   * fixed-capacity array held in the alist itself, searched linearly from
+   * the newest association.  When it grows beyond that, it is promoted to
+   * a persistent hash table from each key to the stack of the values
+   * associated with it, so that lookup no longer depends on the number of
+   * associations.  When `unset` or `remove` shrink it to half the
+   * threshold, it is moved back into the array.  In either
+   * representation, a new association shadows earlier associations with
+   * the same key, and `unset` uncovers them again, as in an `AList`.
+   */
+  template<
+    typename K,
+    typename T,
+    size_type Threshold = Config::Info::Parameters::default_alist_threshold>
+  class AdaptiveAList
+  {
+  public:
+    using key_type = K;
+    using value_type = T;
+    using assoc_type = pair<K, T>;
+
+    static constexpr size_type threshold = Threshold;
+
+    AdaptiveAList() = default;
+
+    /**
+     * @brief Construct an adaptive alist with the associations of the
+     * input alist, in the same order.
+     */
+    explicit AdaptiveAList(AList<K, T> const& xs)
+    {
+      vector<assoc_type> assocs{};
+      doList(xs.toList(), [&](assoc_type const& x) { assocs.push_back(x); });
+      for (auto x = assocs.rbegin(); x != assocs.rend(); ++x) {
+        *this = set(x->first, x->second);
+      }
+    }
+
+  private:
+    using small_type = array<optional<assoc_type>, size_t(Threshold)>;
+    using stack_type = ListType<pair<index_type, T>>;
+    using index_table = HashTable<K, stack_type>;
+
+    // The small representation, held in place, oldest association first,
+    // with the first `count` elements engaged.
+    small_type small{};
+
+    // The large representation, with each value tagged with the sequence
+    // number of its association, newest first.
+    shared_ptr<const index_table> index{};
+
+    size_type count{0};
+    index_type next_seq{0};
+
+    static AdaptiveAList
+    fromIndex(index_table table, size_type count, index_type next_seq)
+    {
+      AdaptiveAList result{};
+      if (count > 0) {
+        result.index = make_shared<const index_table>(std::move(table));
+        result.count = count;
+        result.next_seq = next_seq;
+      }
+      return result.count > Threshold / 2 ? result : result.demote();
+    }
+
+    bool
+    isLarge() const
+    {
+      return bool(index);
+    }
+
+    /**
+     * @brief Return the small associations, oldest first
+     */
+    std::span<optional<assoc_type> const>
+    smallAssocs() const
+    {
+      return std::span(small.data(), size_t(isLarge() ? 0 : count));
+    }
+
+    /**
+     * @brief Return the newest value associated with the input key, if
+     * there is one.
+     */
+    optional<T>
+    find(K const& key) const
+    {
+      if (isLarge()) {
+        auto stack = index->maybeGet(key);
+        return stack ? optional<T>(head(*stack).second) : nullopt;
+      }
+      auto assocs = smallAssocs();
+      for (auto x = assocs.rbegin(); x != assocs.rend(); ++x) {
+        if ((*x)->first == key) {
+          return (*x)->second;
+        }
+      }
+      return nullopt;
+    }
+
+    /**
+     * @brief Return the associations, oldest first
+     */
+    vector<assoc_type>
+    assocsInOrder() const
+    {
+      vector<assoc_type> result{};
+      result.reserve(size_t(count));
+      if (isLarge()) {
+        vector<pair<index_type, assoc_type>> assocs{};
+        assocs.reserve(size_t(count));
+        doEntries(*index, [&](auto const& entry) {
+          doList(entry.second, [&](pair<index_type, T> const& x) {
+            assocs.emplace_back(x.first, assoc_type{entry.first, x.second});
+          });
+        });
+        std::sort(
+          assocs.begin(), assocs.end(), [](auto const& x, auto const& y) {
+            return x.first < y.first;
+          });
+        for (auto& x : assocs) {
+          result.push_back(std::move(x.second));
+        }
+      } else {
+        for (auto const& x : smallAssocs()) {
+          result.push_back(*x);
+        }
+      }
+      return result;
+    }
+
+    /**
+     * @brief Return this alist, promoted to a hash index, with the input
+     * association added
+     */
+    AdaptiveAList
+    promote(K const& key, T const& value) const
+    {
+      index_table table{};
+      index_type seq = 0;
+      auto push = [&](K const& k, T const& v) {
+        auto stack = table.forceGet(k, stack_type{});
+        table = table.set(k, cons(pair(seq++, v), stack));
+      };
+      for (auto const& x : smallAssocs()) {
+        push(x->first, x->second);
+      }
+      push(key, value);
+      return fromIndex(table, count + 1, seq);
+    }
+
+    /**
+     * @brief Return this alist, moved back into the small representation
+     */
+    AdaptiveAList
+    demote() const
+    {
+      AdaptiveAList result{};
+      for (auto& x : assocsInOrder()) {
+        result.small[size_t(result.count++)] = std::move(x);
+      }
+      return result;
+    }
+
+    /**
+     * @brief Return the associations, newest first, as an `AList` would
+     * list them.
+     */
+    template<typename F>
+    auto
+    listOf(F f) const
+    {
+      using U = decay_t<invoke_result_t<F, assoc_type const&>>;
+      ListType<U> result{};
+      for (auto const& x : assocsInOrder()) {
+        result = cons(U(f(x)), result);
+      }
+      return result;
+    }
+
+  public:
+    /**
+     * @brief Return an adaptive alist like this one, with the addition of
+     * the input value associated with the input key.
+     */
+    AdaptiveAList
+    set(K key, T value) const
+    {
+      if (isLarge()) {
+        auto stack = index->forceGet(key, stack_type{});
+        return fromIndex(
+          index->set(key, cons(pair(next_seq, value), stack)),
+          count + 1,
+          next_seq + 1);
+      }
+      if (count == threshold) {
+        return promote(key, value);
+      }
+      AdaptiveAList result = *this;
+      result.small[size_t(result.count++)].emplace(key, value);
+      return result;
+    }
+
+    friend AdaptiveAList
+    set(K key, T value, AdaptiveAList xs)
+    {
+      return xs.set(key, value);
+    }
+
+    /**
+     * @brief Remove the newest association with the input key, uncovering
+     * the association it shadowed, if any.
+     */
+    AdaptiveAList
+    unset(K key) const
+    {
+      if (isLarge()) {
+        auto stack = index->maybeGet(key);
+        if (!stack) {
+          return *this;
+        }
+        stack_type rest = tail(*stack);
+        return fromIndex(
+          rest.hasData() ? index->set(key, rest) : index->remove(key),
+          count - 1,
+          next_seq);
+      }
+      for (size_type i = count - 1; i >= 0; --i) {
+        if (small[size_t(i)]->first == key) {
+          AdaptiveAList result = *this;
+          std::move(
+            result.small.begin() + i + 1,
+            result.small.begin() + count,
+            result.small.begin() + i);
+          result.small[size_t(--result.count)].reset();
+          return result;
+        }
+      }
+      return *this;
+    }
+
+    friend AdaptiveAList
+    unset(K key, AdaptiveAList xs)
+    {
+      return xs.unset(key);
+    }
+
+    /**
+     * @brief Remove all associations with the input key.
+     */
+    AdaptiveAList
+    remove(K key) const
+    {
+      if (isLarge()) {
+        auto stack = index->maybeGet(key);
+        if (!stack) {
+          return *this;
+        }
+        size_type removed = 0;
+        doList(*stack, [&](auto const&) { ++removed; });
+        return fromIndex(index->remove(key), count - removed, next_seq);
+      }
+      AdaptiveAList result{};
+      for (auto const& x : smallAssocs()) {
+        if (x->first != key) {
+          result.small[size_t(result.count++)] = x;
+        }
+      }
+      return result.count == count ? *this : result;
+    }
+
+    friend AdaptiveAList
+    remove(K key, AdaptiveAList xs)
+    {
+      return xs.remove(key);
+    }
+
+    bool
+    hasKey(K const& key) const
+    {
+      if (isLarge()) {
+        return index->hasKey(key);
+      }
+      auto assocs = smallAssocs();
+      return std::any_of(
+        assocs.begin(), assocs.end(), [&](optional<assoc_type> const& x) {
+          return x->first == key;
+        });
+    }
+
+    friend bool
+    hasKey(K const& key, AdaptiveAList const& xs)
+    {
+      return xs.hasKey(key);
+    }
+
+    T
+    forceGet(K const& key, T const& alternate) const
+    {
+      return find(key).value_or(alternate);
+    }
+
+    friend T
+    forceGet(K const& key, T const& alternate, AdaptiveAList const& xs)
+    {
+      return xs.forceGet(key, alternate);
+    }
+
+    optional<T>
+    maybeGet(K const& key) const
+    {
+      return find(key);
+    }
+
+    friend optional<T>
+    maybeGet(K const& key, AdaptiveAList const& xs)
+    {
+      return xs.maybeGet(key);
+    }
+
+    T
+    tryGet(K const& key) const
+    {
+      optional<T> value = find(key);
+      if (!value) {
+        throw logic_error("AdaptiveAList does not have requested key!");
+      }
+      return *value;
+    }
+
+    friend T
+    tryGet(K const& key, AdaptiveAList const& xs)
+    {
+      return xs.tryGet(key);
+    }
+
+    bool
+    hasData() const
+    {
+      return count > 0;
+    }
+
+    friend bool
+    hasData(AdaptiveAList const& xs)
+    {
+      return xs.hasData();
+    }
+
+    bool
+    isEmpty() const
+    {
+      return count == 0;
+    }
+
+    friend bool
+    isEmpty(AdaptiveAList const& xs)
+    {
+      return xs.isEmpty();
+    }
+
+    /**
+     * @brief Return `true` if this alist has been promoted to a hash index
+     */
+    bool
+    isHashed() const
+    {
+      return isLarge();
+    }
+
+    /**
+     * @brief Return the number of associations, including shadowed ones
+     */
+    size_type
+    length() const
+    {
+      return count;
+    }
+
+    friend size_type
+    length(AdaptiveAList const& xs)
+    {
+      return xs.length();
+    }
+
+    auto
+    keys() const
+    {
+      return listOf([](assoc_type const& x) { return x.first; });
+    }
+
+    friend auto
+    keys(AdaptiveAList const& xs)
+    {
+      return xs.keys();
+    }
+
+    auto
+    vals() const
+    {
+      return listOf([](assoc_type const& x) { return x.second; });
+    }
+
+    friend auto
+    vals(AdaptiveAList const& xs)
+    {
+      return xs.vals();
+    }
+
+    auto
+    toList() const
+    {
+      return listOf([](assoc_type const& x) { return x; });
+    }
+
+    friend auto
+    toList(AdaptiveAList const& xs)
+    {
+      return xs.toList();
+    }
+
+    /**
+     * @brief Return an `AList` with the associations of this alist
+     */
+    AList<K, T>
+    toAList() const
+    {
+      return AList<K, T>(toList());
+    }
+
+  }; // end of class AdaptiveAList
+
+  template<typename K, typename T>
+  inline constinit const AdaptiveAList<K, T> empty_adaptive_alist{};
+
+  template<typename... Ks, typename... Vs>
+  auto
+  adaptiveAList(pair<Ks, Vs> const&... pairs)
+  {
+    using K = common_type_t<Ks...>;
+    using V = common_type_t<Vs...>;
+    return AdaptiveAList<K, V>(alist(pairs...));
+  }
+
+} // end of namespace ListProcessing::Dynamic::Details
@@ -0,0 +1,127 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/import.hpp>
+
+namespace ListProcessing::Dynamic::Details {
+
+  /**
+   * @brief The default size, in bytes, of the blocks of an `Arena`
+   */
+  constexpr size_type default_arena_block_size = 64 * 1024;
+
+  /**
+   * @brief A region of memory from which objects are allocated by bumping
+   * a pointer, and which is released all at once
+   *
+   * @details Memory is taken from the system in blocks, and nothing
+   * allocated from an arena is released before the arena itself.  An
+   * arena is not synchronized: it is meant to be filled by one thread,
+   * as a decoder fills it, and then only read.
+   */
+  class Arena
+  {
+  public:
+    explicit Arena(size_type block_size = default_arena_block_size)
+      : block_size(block_size)
+    {}
+
+    Arena(Arena const&) = delete;
+
+    Arena&
+    operator=(Arena const&) = delete;
+
+    /**
+     * @brief Return storage for the input number of bytes, with the input
+     * alignment.
+     */
+    void*
+    allocate(size_t bytes, size_t alignment)
+    {
+      if (blocks.empty() || cursor + padding(alignment) + bytes > capacity) {
+        capacity = std::max(size_t(block_size), bytes + alignment);
+        blocks.push_back(
+          std::make_unique_for_overwrite<std::byte[]>(capacity));
+        cursor = 0;
+        total += capacity;
+      }
+      cursor += padding(alignment);
+      void* result = blocks.back().get() + cursor;
+      cursor += bytes;
+      return result;
+    }
+
+    /**
+     * @brief Return the number of bytes taken from the system
+     */
+    size_type
+    reserved() const
+    {
+      return total;
+    }
+
+  private:
+    size_t
+    padding(size_t alignment) const
+    {
+      auto address =
+        reinterpret_cast<std::uintptr_t>(blocks.back().get() + cursor);
+      return (alignment - address % alignment) % alignment;
+    }
+
+    size_type block_size;
+    vector<unique_ptr<std::byte[]>> blocks{};
+    size_t cursor{0};
+    size_t capacity{0};
+    size_type total{0};
+  };
+
+  /**
+   * @brief An allocator taking its storage from a shared `Arena`
+   *
+   * @details Each copy of the allocator shares ownership of the arena, so
+   * that an arena used through `allocate_shared` lives as long as any of
+   * the objects allocated from it.  Deallocation does nothing.
+   */
+  template<typename T>
+  class ArenaAllocator
+  {
+  public:
+    using value_type = T;
+
+    explicit ArenaAllocator(shared_ptr<Arena> arena)
+      : arena(std::move(arena))
+    {}
+
+    template<typename U>
+    ArenaAllocator(ArenaAllocator<U> const& other)
+      : arena(other.arena)
+    {}
+
+    T*
+    allocate(size_t n)
+    {
+      return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void
+    deallocate(T*, size_t)
+    {}
+
+    template<typename U>
+    friend bool
+    operator==(ArenaAllocator const& x, ArenaAllocator<U> const& y)
+    {
+      return x.arena == y.arena;
+    }
+
+  private:
+    template<typename U>
+    friend class ArenaAllocator;
+
+    shared_ptr<Arena> arena;
+  };
+
+} // end of namespace ListProcessing::Dynamic::Details
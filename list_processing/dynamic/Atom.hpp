@@ -0,0 +1,172 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/import.hpp>
+
+namespace ListProcessing::Dynamic::Details {
+
+  /**
+   * @brief A thread-safe, mutable reference to a persistent value.
+   *
+   * @details An `Atom` holds the current snapshot of a persistent value
+   * such as a `List`, `AList`, `Queue`, `Tape` or `Tree`.  Because the
+   * snapshots are immutable, readers can `load` one and use it for as long
+   * as they like without any further synchronization, while writers
+   * publish replacements with `store`, `exchange`, `compareExchange` or
+   * `swap`.  Publication is a single atomic pointer update, so readers never
+   * observe a partially updated value and never block a writer.
+   *
+   * @tparam T - a type parameter specifying the type of the snapshots
+   */
+  template<typename T>
+  class Atom {
+  public:
+    using value_type = T;
+    using const_reference = value_type const&;
+
+    Atom()
+      : ptr{make_shared<const value_type>()} {}
+
+    explicit Atom(value_type x)
+      : ptr{make_shared<const value_type>(std::move(x))} {}
+
+    Atom(Atom const&) = delete;
+
+    Atom&
+    operator=(Atom const&) = delete;
+
+  private:
+    using pointer = shared_ptr<const value_type>;
+
+    atomic<pointer> ptr;
+
+  public:
+    /**
+     * @brief Return the current snapshot held by this atom.
+     */
+    value_type
+    load() const {
+      return *ptr.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Return the current snapshot held by the input atom.
+     */
+    friend value_type
+    load(Atom const& atom) {
+      return atom.load();
+    }
+
+    /**
+     * @brief Replace the snapshot held by this atom.
+     */
+    void
+    store(value_type x) {
+      ptr.store(
+        make_shared<const value_type>(std::move(x)),
+        std::memory_order_release);
+    }
+
+    /**
+     * @brief Replace the snapshot held by the input atom.
+     */
+    friend void
+    store(Atom& atom, value_type x) {
+      atom.store(std::move(x));
+    }
+
+    /**
+     * @brief Replace the snapshot held by this atom and return the
+     * snapshot that it replaced.
+     */
+    value_type
+    exchange(value_type x) {
+      return *ptr.exchange(
+        make_shared<const value_type>(std::move(x)),
+        std::memory_order_acq_rel);
+    }
+
+    /**
+     * @brief Replace the snapshot held by the input atom and return the
+     * snapshot that it replaced.
+     */
+    friend value_type
+    exchange(Atom& atom, value_type x) {
+      return atom.exchange(std::move(x));
+    }
+
+    /**
+     * @brief Replace the snapshot held by this atom with `desired` if the
+     * current snapshot is equal to `expected`.
+     *
+     * @details Return true if the snapshot was replaced.  Otherwise,
+     * `expected` is updated with the current snapshot and false is returned.
+     */
+    bool
+    compareExchange(value_type& expected, value_type desired)
+      requires equality_comparable<value_type>
+    {
+      pointer current = ptr.load(std::memory_order_acquire);
+      pointer next = make_shared<const value_type>(std::move(desired));
+      while (*current == expected) {
+        if (ptr.compare_exchange_weak(
+              current,
+              next,
+              std::memory_order_acq_rel,
+              std::memory_order_acquire)) {
+          return true;
+        }
+      }
+      expected = *current;
+      return false;
+    }
+
+    /**
+     * @brief Replace the snapshot held by the input atom with `desired` if
+     * the current snapshot is equal to `expected`.
+     */
+    friend bool
+    compareExchange(Atom& atom, value_type& expected, value_type desired)
+      requires equality_comparable<value_type>
+    {
+      return atom.compareExchange(expected, std::move(desired));
+    }
+
+    /**
+     * @brief Replace the snapshot held by this atom with the result of
+     * applying the input function to it, and return the new snapshot.
+     *
+     * @details The function may be called more than once when other
+     * writers race with this one, so it should be free of side effects.
+     */
+    template<invocable<const_reference> F>
+    value_type
+    swap(F f) {
+      pointer current = ptr.load(std::memory_order_acquire);
+      pointer next = make_shared<const value_type>(f(*current));
+      pointer seen = current;
+      while (!ptr.compare_exchange_weak(
+        current, next, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        if (current != seen) {
+          next = make_shared<const value_type>(f(*current));
+          seen = current;
+        }
+      }
+      return *next;
+    }
+
+    /**
+     * @brief Replace the snapshot held by the input atom with the result of
+     * applying the input function to it, and return the new snapshot.
+     */
+    template<invocable<const_reference> F>
+    friend value_type
+    swap(Atom& atom, F f) {
+      return atom.swap(f);
+    }
+
+  }; // end of class Atom
+
+} // end of namespace ListProcessing::Dynamic::Details
@@ -0,0 +1,968 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/config.hpp>
+#include <list_processing/dynamic/List.hpp>
+#include <list_processing/dynamic/import.hpp>
+
+namespace ListProcessing::Dynamic::Details {
+
+  /**
+   * @brief A bi-directional sequence of values stored in chunks
+   *
+   * @details A `ChunkedTape` presents the interface of `Tape`, but the
+   * values are held in a persistent rope: a height balanced binary tree
+   * whose leaves are chunks of up to `N` values.  The tape records its
+   * position and the leaf under the cursor, so moving within a chunk does
+   * not allocate, while seeking to an arbitrary position, inserting and
+   * erasing take O(log n) time.  Edits copy the path to the affected
+   * leaf and share the rest of the rope with the original tape.
+   *
+   * @tparam T - a type parameter specifying the type of the values
+   *
+   * @tparam N - an integral parameter specifying the maximum number of
+   * values in a chunk
+   */
+  template<
+    typename T,
+    size_type N = ListProcessing::Config::Info::Parameters::default_chunk_size>
+  class ChunkedTape {
+    static_assert(N > 0);
+
+  public:
+    using value_type = T;
+    using const_reference = value_type const&;
+    static constexpr size_type chunk_size = N;
+
+    constexpr ChunkedTape() = default;
+
+  private:
+    template<typename U, size_type M>
+    friend class Tree;
+
+    struct Node;
+    using pointer = shared_ptr<const Node>;
+
+    struct Node {
+      explicit Node(vector<value_type> input_values)
+        : size{size_type(input_values.size())}
+        , values(std::move(input_values)) {}
+
+      Node(pointer input_left, pointer input_right)
+        : size{input_left->size + input_right->size}
+        , height{std::max(input_left->height, input_right->height) + 1}
+        , left{input_left}
+        , right{input_right} {}
+
+      bool
+      isLeaf() const {
+        return !left;
+      }
+
+      size_type size;
+      size_type height{1};
+      pointer left{};
+      pointer right{};
+      vector<value_type> values{};
+    };
+
+    pointer root{};
+    index_type pos{0};
+    bool reversed{false};
+
+    // The leaf holding the value under the cursor, which is kept
+    // alive by `root`, and the index of its first value.
+    Node const* leaf{nullptr};
+    index_type leaf_start{0};
+
+    ChunkedTape(pointer input_root, index_type input_pos, bool input_reversed)
+      : root{input_root}
+      , pos{input_pos}
+      , reversed{input_reversed} {
+      seek();
+    }
+
+    ChunkedTape(ChunkedTape const& xs, index_type input_pos)
+      : root{xs.root}
+      , pos{input_pos}
+      , reversed{xs.reversed}
+      , leaf{xs.leaf}
+      , leaf_start{xs.leaf_start} {
+      if (!(leaf && physical(pos) >= leaf_start &&
+            physical(pos) < leaf_start + leaf->size)) {
+        seek();
+      }
+    }
+
+    //
+    // ... Rope operations
+    //
+
+    static size_type
+    sizeOf(pointer const& p) {
+      return p ? p->size : 0;
+    }
+
+    static size_type
+    heightOf(pointer const& p) {
+      return p ? p->height : 0;
+    }
+
+    static pointer
+    makeLeaf(vector<value_type> values) {
+      return values.empty() ? pointer{} : make_shared<const Node>(values);
+    }
+
+    static pointer
+    makeNode(pointer const& l, pointer const& r) {
+      return make_shared<const Node>(l, r);
+    }
+
+    /**
+     * @brief Return a node with the input children, rotating to restore
+     * the balance when their heights differ by two.
+     */
+    static pointer
+    balance(pointer const& l, pointer const& r) {
+      if (heightOf(l) > heightOf(r) + 1) {
+        if (heightOf(l->left) >= heightOf(l->right)) {
+          return makeNode(l->left, makeNode(l->right, r));
+        }
+        return makeNode(
+          makeNode(l->left, l->right->left), makeNode(l->right->right, r));
+      }
+      if (heightOf(r) > heightOf(l) + 1) {
+        if (heightOf(r->right) >= heightOf(r->left)) {
+          return makeNode(makeNode(l, r->left), r->right);
+        }
+        return makeNode(
+          makeNode(l, r->left->left), makeNode(r->left->right, r->right));
+      }
+      return makeNode(l, r);
+    }
+
+    /**
+     * @brief Return the concatenation of the input ropes.
+     */
+    static pointer
+    join(pointer const& l, pointer const& r) {
+      if (!l) {
+        return r;
+      }
+      if (!r) {
+        return l;
+      }
+      if (l->isLeaf() && r->isLeaf() && l->size + r->size <= N) {
+        vector<value_type> values(l->values);
+        values.insert(values.end(), r->values.begin(), r->values.end());
+        return makeLeaf(std::move(values));
+      }
+      if (l->height > r->height + 1) {
+        return balance(l->left, join(l->right, r));
+      }
+      if (r->height > l->height + 1) {
+        return balance(join(l, r->left), r->right);
+      }
+      return makeNode(l, r);
+    }
+
+    /**
+     * @brief Return the ropes holding the values before and from the
+     * input index.
+     */
+    static pair<pointer, pointer>
+    split(pointer const& p, index_type index) {
+      if (!p) {
+        return {};
+      }
+      if (index <= 0) {
+        return {pointer{}, p};
+      }
+      if (index >= p->size) {
+        return {p, pointer{}};
+      }
+      if (p->isLeaf()) {
+        return {
+          makeLeaf(
+            vector<value_type>(p->values.begin(), p->values.begin() + index)),
+          makeLeaf(
+            vector<value_type>(p->values.begin() + index, p->values.end()))};
+      }
+      size_type left_size = p->left->size;
+      if (index < left_size) {
+        auto [a, b] = split(p->left, index);
+        return {a, join(b, p->right)};
+      }
+      auto [a, b] = split(p->right, index - left_size);
+      return {join(p->left, a), b};
+    }
+
+    static pointer
+    insertAt(pointer const& p, index_type index, const_reference x) {
+      if (!p) {
+        return makeLeaf({x});
+      }
+      if (p->isLeaf()) {
+        vector<value_type> values(p->values);
+        values.insert(values.begin() + index, x);
+        if (size_type(values.size()) <= N) {
+          return makeLeaf(values);
+        }
+        auto middle = values.begin() + values.size() / 2;
+        return makeNode(
+          makeLeaf(vector<value_type>(values.begin(), middle)),
+          makeLeaf(vector<value_type>(middle, values.end())));
+      }
+      size_type left_size = p->left->size;
+      return index <= left_size
+               ? balance(insertAt(p->left, index, x), p->right)
+               : balance(p->left, insertAt(p->right, index - left_size, x));
+    }
+
+    static pointer
+    eraseAt(pointer const& p, index_type index) {
+      if (p->isLeaf()) {
+        vector<value_type> values(p->values);
+        values.erase(values.begin() + index);
+        return makeLeaf(values);
+      }
+      size_type left_size = p->left->size;
+      if (index < left_size) {
+        pointer l = eraseAt(p->left, index);
+        return l ? balance(l, p->right) : p->right;
+      }
+      pointer r = eraseAt(p->right, index - left_size);
+      return r ? balance(p->left, r) : p->left;
+    }
+
+    static pointer
+    writeAt(pointer const& p, index_type index, const_reference x) {
+      if (p->isLeaf()) {
+        vector<value_type> values(p->values);
+        values[index] = x;
+        return makeLeaf(values);
+      }
+      size_type left_size = p->left->size;
+      return index < left_size
+               ? makeNode(writeAt(p->left, index, x), p->right)
+               : makeNode(p->left, writeAt(p->right, index - left_size, x));
+    }
+
+    /**
+     * @brief Return a balanced rope holding the input values.
+     */
+    static pointer
+    build(vector<value_type> const& values) {
+      vector<pointer> level{};
+      for (size_type i = 0; i < size_type(values.size()); i += N) {
+        auto first = values.begin() + i;
+        auto last = values.begin() + std::min(i + N, size_type(values.size()));
+        level.push_back(makeLeaf(vector<value_type>(first, last)));
+      }
+      while (level.size() > 1) {
+        vector<pointer> next{};
+        for (size_type i = 0; i < size_type(level.size()); i += 2) {
+          next.push_back(
+            i + 1 < size_type(level.size()) ? makeNode(level[i], level[i + 1])
+                                            : level[i]);
+        }
+        level = std::move(next);
+      }
+      return level.empty() ? pointer{} : level.front();
+    }
+
+    /**
+     * @brief Call a function with each value with an index in the half
+     * open range [first, last), in order.
+     */
+    template<typename F>
+    static void
+    forEachIn(pointer const& p, index_type first, index_type last, F& f) {
+      if (!p || first >= last) {
+        return;
+      }
+      if (p->isLeaf()) {
+        for (index_type i = std::max(first, index_type(0));
+             i < std::min(last, p->size);
+             ++i) {
+          f(p->values[i]);
+        }
+        return;
+      }
+      size_type left_size = p->left->size;
+      if (first < left_size) {
+        forEachIn(p->left, first, last, f);
+      }
+      if (last > left_size) {
+        forEachIn(p->right, first - left_size, last - left_size, f);
+      }
+    }
+
+    //
+    // ... Cursor
+    //
+
+    size_type
+    total() const {
+      return sizeOf(root);
+    }
+
+    /**
+     * @brief Return the index in the rope of the value with the input
+     * index in this tape.
+     */
+    index_type
+    physical(index_type index) const {
+      return reversed ? total() - 1 - index : index;
+    }
+
+    void
+    seek() {
+      leaf = nullptr;
+      leaf_start = 0;
+      if (pos >= total()) {
+        return;
+      }
+      index_type index = physical(pos);
+      Node const* p = root.get();
+      while (!p->isLeaf()) {
+        if (index < p->left->size) {
+          p = p->left.get();
+        } else {
+          leaf_start += p->left->size;
+          index -= p->left->size;
+          p = p->right.get();
+        }
+      }
+      leaf = p;
+    }
+
+    /**
+     * @brief Return a rope holding the values of this tape in order.
+     */
+    pointer
+    normalized() const {
+      if (!reversed) {
+        return root;
+      }
+      vector<value_type> values{};
+      values.reserve(total());
+      auto push = [&](const_reference x) { values.push_back(x); };
+      forEachIn(root, 0, total(), push);
+      std::reverse(values.begin(), values.end());
+      return build(values);
+    }
+
+    /**
+     * @brief Return the half open range of indices in the rope of the
+     * values with indices in [first, last) in this tape.
+     */
+    pair<index_type, index_type>
+    physicalRange(index_type first, index_type last) const {
+      using Range = pair<index_type, index_type>;
+      return reversed ? Range{total() - last, total() - first}
+                      : Range{first, last};
+    }
+
+    /**
+     * @brief Return a list of the values with indices in [first, last)
+     * in this tape.
+     */
+    List<T>
+    listOf(index_type first, index_type last) const {
+      vector<value_type const*> values{};
+      auto push = [&](const_reference x) { values.push_back(&x); };
+      auto [lo, hi] = physicalRange(first, last);
+      forEachIn(root, lo, hi, push);
+      if (reversed) {
+        std::reverse(values.begin(), values.end());
+      }
+      return buildListAux(
+        [&](index_type i) -> const_reference { return *values[i]; },
+        size_type(values.size()),
+        List<T>{});
+    }
+
+    /**
+     * @brief Call a function with each element held only by the input
+     * tape, that is, each element in a chunk that is released with the
+     * tape, in no particular order
+     *
+     * @details A node is entered only after its use count is seen to
+     * be one, and the acquire fence that follows orders the reads of
+     * the node after the releases of every other owner that dropped it.
+     */
+    template<typename F>
+    static F
+    doOwned(ChunkedTape const& xs, F f) {
+      vector<Node const*> nodes{};
+      if (xs.root.use_count() == 1) {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        nodes.push_back(xs.root.get());
+      }
+      while (!nodes.empty()) {
+        Node const* p = nodes.back();
+        nodes.pop_back();
+        if (p->isLeaf()) {
+          for (const_reference x : p->values) {
+            f(x);
+          }
+          continue;
+        }
+        if (p->left.use_count() == 1) {
+          std::atomic_thread_fence(std::memory_order_acquire);
+          nodes.push_back(p->left.get());
+        }
+        if (p->right.use_count() == 1) {
+          std::atomic_thread_fence(std::memory_order_acquire);
+          nodes.push_back(p->right.get());
+        }
+      }
+      return f;
+    }
+
+    ChunkedTape
+    insertValues(vector<value_type> values) const {
+      if (reversed) {
+        std::reverse(values.begin(), values.end());
+      }
+      index_type index = reversed ? total() - pos : pos;
+      auto [before, after] = split(root, index);
+      return ChunkedTape(
+        join(join(before, build(values)), after), pos, reversed);
+    }
+
+  public:
+    /**
+     * @brief Construct a tape holding the input values, positioned at
+     * the front.
+     */
+    explicit ChunkedTape(vector<value_type> const& values)
+      : ChunkedTape(build(values), 0, false) {}
+
+    /**
+     * @brief Return true if the elements of the tapes are equal and the
+     * tapes are at the same position
+     */
+    friend bool
+    operator==(ChunkedTape const& xs, ChunkedTape const& ys) {
+      if (xs.pos != ys.pos || xs.length() != ys.length()) {
+        return false;
+      }
+      if (xs.root == ys.root && xs.reversed == ys.reversed) {
+        return true;
+      }
+      for (index_type i = 0; i < xs.length(); ++i) {
+        if (!(xs.at(i) == ys.at(i))) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /**
+     * @brief Return true if the input tapes are not equal
+     */
+    friend bool
+    operator!=(ChunkedTape const& xs, ChunkedTape const& ys) {
+      return !(xs == ys);
+    }
+
+    /**
+     * @brief Return the value with the input index, in O(log n) time.
+     */
+    const_reference
+    at(index_type index) const {
+      if (index < 0 || index >= total()) {
+        throw logic_error("Index out of the range of the tape");
+      }
+      ChunkedTape xs(*this, index);
+      return xs.read();
+    }
+
+    /**
+     * @brief Reverse the elements of this tape
+     */
+    ChunkedTape
+    reverse() const {
+      return ChunkedTape(root, total() - pos, !reversed);
+    }
+
+    /**
+     * @brief Reverse the elements of the input tape
+     */
+    friend ChunkedTape
+    reverse(ChunkedTape const& xs) {
+      return xs.reverse();
+    }
+
+    /**
+     * @brief Return true if this tape is at the back
+     */
+    bool
+    isAtBack() const {
+      return pos == total();
+    }
+
+    /**
+     * @brief Return true if the tape is at the back
+     */
+    friend bool
+    isAtBack(ChunkedTape const& xs) {
+      return xs.isAtBack();
+    }
+
+    /**
+     * @brief Return true if this tape is at the front
+     */
+    bool
+    isAtFront() const {
+      return pos == 0;
+    }
+
+    /**
+     * @brief Return true if the tape is at the front
+     */
+    friend bool
+    isAtFront(ChunkedTape const& xs) {
+      return xs.isAtFront();
+    }
+
+    /**
+     * @brief Return true if this tape is empty
+     */
+    bool
+    isEmpty() const {
+      return !root;
+    }
+
+    /**
+     * @brief Return true if the tape is empty
+     */
+    friend bool
+    isEmpty(ChunkedTape const& xs) {
+      return xs.isEmpty();
+    }
+
+    /**
+     * @brief Insert a value into this tape, at the cursor
+     */
+    ChunkedTape
+    insert(const_reference x) const {
+      index_type index = reversed ? total() - pos : pos;
+      return ChunkedTape(insertAt(root, index, x), pos, reversed);
+    }
+
+    /**
+     * @brief Insert a value into the tape, at the cursor
+     */
+    friend ChunkedTape
+    insert(const_reference x, ChunkedTape const& xs) {
+      return xs.insert(x);
+    }
+
+    /**
+     * @brief Remove the value under the cursor from this tape
+     */
+    ChunkedTape
+    erase() const {
+      return isAtBack()
+               ? *this
+               : ChunkedTape(eraseAt(root, physical(pos)), pos, reversed);
+    }
+
+    /**
+     * @brief Remove the value under the cursor from the tape
+     */
+    friend ChunkedTape
+    erase(ChunkedTape const& xs) {
+      return xs.erase();
+    }
+
+    /**
+     * @brief Remove the value under the cursor from this tape
+     */
+    ChunkedTape
+    remove() const {
+      return erase();
+    }
+
+    /**
+     * @brief Remove the value under the cursor from the tape
+     */
+    friend ChunkedTape
+    remove(ChunkedTape const& xs) {
+      return xs.erase();
+    }
+
+    /**
+     * @brief Write the input value to the tape head
+     */
+    ChunkedTape
+    write(const_reference x) const {
+      return isAtBack()
+               ? insert(x)
+               : ChunkedTape(writeAt(root, physical(pos), x), pos, reversed);
+    }
+
+    /**
+     * @brief Write the input value to the tape head
+     */
+    friend ChunkedTape
+    write(ChunkedTape const& xs, const_reference x) {
+      return xs.write(x);
+    }
+
+    /**
+     * @brief Read the value from the head of this tape
+     */
+    const_reference
+    read() const {
+      if (!leaf) {
+        throw logic_error("Cannot read at the back of a tape");
+      }
+      return leaf->values[physical(pos) - leaf_start];
+    }
+
+    /**
+     * @brief Read the value from the head of the tape
+     */
+    friend value_type
+    read(ChunkedTape const& xs) {
+      return xs.read();
+    }
+
+    /**
+     * @brief Return the position of this tape
+     */
+    index_type
+    position() const {
+      return pos;
+    }
+
+    /**
+     * @brief Return the position of the tape
+     */
+    friend index_type
+    position(ChunkedTape const& xs) {
+      return xs.position();
+    }
+
+    /**
+     * @brief Return the number of items remaining in the tape
+     */
+    size_type
+    remaining() const {
+      return total() - pos;
+    }
+
+    /**
+     * @brief Return the number of items remaining in the tape
+     */
+    friend size_type
+    remaining(ChunkedTape const& xs) {
+      return xs.remaining();
+    }
+
+    /**
+     * @brief Return the total number of items in this tape
+     */
+    size_type
+    length() const {
+      return total();
+    }
+
+    /**
+     * @brief Return the total number of items in the tape
+     */
+    friend size_type
+    length(ChunkedTape const& xs) {
+      return xs.length();
+    }
+
+    /**
+     * @brief Move to the next item in this tape
+     */
+    ChunkedTape
+    fwd() const {
+      if (isAtBack()) {
+        throw logic_error("Cannot move past the back of a tape");
+      }
+      return ChunkedTape(*this, pos + 1);
+    }
+
+    /**
+     * @brief Move to the next item in the tape
+     */
+    friend ChunkedTape
+    fwd(ChunkedTape const& xs) {
+      return xs.fwd();
+    }
+
+    /**
+     * @brief Move to the previous item in this tape
+     */
+    ChunkedTape
+    bwd() const {
+      if (isAtFront()) {
+        throw logic_error("Cannot move past the front of a tape");
+      }
+      return ChunkedTape(*this, pos - 1);
+    }
+
+    /**
+     * @brief Move to the previous item in the tape
+     */
+    friend ChunkedTape
+    bwd(ChunkedTape const& xs) {
+      return xs.bwd();
+    }
+
+    /**
+     * @brief Move by the specified number of items
+     */
+    ChunkedTape
+    moveBy(offset_type offset) const {
+      return moveTo(pos + offset);
+    }
+
+    /**
+     * @brief Move by the specified number of items
+     */
+    friend ChunkedTape
+    moveBy(offset_type offset, ChunkedTape const& xs) {
+      return xs.moveBy(offset);
+    }
+
+    /**
+     * @brief Move to the indicated position
+     */
+    ChunkedTape
+    moveTo(index_type index) const {
+      if (index < 0 || index > total()) {
+        throw logic_error("Cannot move outside of a tape");
+      }
+      return ChunkedTape(*this, index);
+    }
+
+    /**
+     * @brief Move to the indicated position
+     */
+    friend ChunkedTape
+    moveTo(index_type index, ChunkedTape const& xs) {
+      return xs.moveTo(index);
+    }
+
+    /**
+     * @brief Move to the front of this tape
+     */
+    ChunkedTape
+    toFront() const {
+      return moveTo(0);
+    }
+
+    /**
+     * @brief Move to the front of the tape
+     */
+    friend ChunkedTape
+    toFront(ChunkedTape const& xs) {
+      return xs.toFront();
+    }
+
+    /**
+     * @brief Move to the back of this tape
+     */
+    ChunkedTape
+    toBack() const {
+      return moveTo(total());
+    }
+
+    /**
+     * @brief Move to the back of the tape
+     */
+    friend ChunkedTape
+    toBack(ChunkedTape const& xs) {
+      return xs.toBack();
+    }
+
+    /**
+     * @brief Splice another tape into this tape
+     *
+     * @details As with `Tape`, the values of the input tape before its
+     * cursor are placed before the values of this tape, and the values
+     * after its cursor are placed after them.  The cursor of the result is
+     * between the values before and after the cursor of this tape.
+     */
+    ChunkedTape
+    splice(ChunkedTape const& ys) const {
+      auto [xs_before, xs_after] = split(normalized(), pos);
+      auto [ys_before, ys_after] = split(ys.normalized(), ys.pos);
+      return ChunkedTape(
+        join(join(ys_before, xs_before), join(xs_after, ys_after)),
+        ys.pos + pos,
+        false);
+    }
+
+    /**
+     * @brief Splice two tapes
+     */
+    friend ChunkedTape
+    splice(ChunkedTape const& xs, ChunkedTape const& ys) {
+      return xs.splice(ys);
+    }
+
+    /**
+     * @brief Insert the elements of a list into this tape, with the
+     * first of them under the cursor
+     */
+    template<size_type M>
+    ChunkedTape
+    insertRange(List<value_type, M> const& xs) const {
+      vector<value_type> values{};
+      doList(xs, [&](const_reference x) { values.push_back(x); });
+      return insertValues(std::move(values));
+    }
+
+    /**
+     * @brief Insert the elements of a range into this tape, with the
+     * first of them under the cursor
+     *
+     * @details The values are packed into full chunks, which are joined
+     * into the rope in O(log n) time.
+     */
+    template<typename R>
+      requires requires(R const& xs) {
+        std::begin(xs);
+        std::end(xs);
+      }
+    ChunkedTape
+    insertRange(R const& xs) const {
+      return insertValues(vector<value_type>(std::begin(xs), std::end(xs)));
+    }
+
+    /**
+     * @brief Insert the elements of a range into the tape
+     */
+    template<typename R>
+    friend ChunkedTape
+    insertRange(R const& ys, ChunkedTape const& xs) {
+      return xs.insertRange(ys);
+    }
+
+    /**
+     * @brief Remove up to n values from this tape, starting at the cursor
+     */
+    ChunkedTape
+    removeN(size_type n) const {
+      auto [first, last] = physicalRange(pos, pos + std::min(n, remaining()));
+      auto [before, rest] = split(root, first);
+      return ChunkedTape(
+        join(before, split(rest, last - first).second), pos, reversed);
+    }
+
+    /**
+     * @brief Remove up to n values from the tape, starting at the cursor
+     */
+    friend ChunkedTape
+    removeN(size_type n, ChunkedTape const& xs) {
+      return xs.removeN(n);
+    }
+
+    /**
+     * @brief Return a list of up to n values from the cursor, and this
+     * tape with those values removed
+     */
+    pair<List<T>, ChunkedTape>
+    extract(size_type n) const {
+      return {listOf(pos, pos + std::min(n, remaining())), removeN(n)};
+    }
+
+    /**
+     * @brief Return a list of up to n values from the cursor, and the
+     * tape with those values removed
+     */
+    friend pair<List<T>, ChunkedTape>
+    extract(size_type n, ChunkedTape const& xs) {
+      return xs.extract(n);
+    }
+
+    /**
+     * @brief Return the remaining elements of the tape as a list
+     */
+    List<T>
+    toList() const {
+      return listOf(pos, total());
+    }
+
+    /**
+     * @brief Return the remaining elements of the tape as a list
+     */
+    friend List<T>
+    toList(ChunkedTape const& xs) {
+      return xs.toList();
+    }
+
+    /**
+     * @brief Call a function with each element of the input tape, by
+     * reference, from the front to the back
+     */
+    template<typename F>
+    friend F
+    doTape(ChunkedTape const& xs, F f) {
+      if (xs.reversed) {
+        vector<value_type const*> values{};
+        auto push = [&](const_reference x) { values.push_back(&x); };
+        forEachIn(xs.root, 0, xs.total(), push);
+        for (auto x = values.rbegin(); x != values.rend(); ++x) {
+          f(**x);
+        }
+      } else {
+        forEachIn(xs.root, 0, xs.total(), f);
+      }
+      return f;
+    }
+
+    template<typename OStream>
+    friend OStream&
+    printTape(OStream& os, ChunkedTape const& xs) {
+      if (xs.isEmpty()) {
+        os << "tape([])";
+      } else if (xs.isAtBack()) {
+        os << "tape(...[])";
+      } else if (xs.isAtFront()) {
+        os << "tape([" << xs.read() << "]...)";
+      } else {
+        os << "tape(...[" << xs.read() << "]...)";
+      }
+      return os;
+    }
+
+    friend ostream&
+    operator<<(ostream& os, ChunkedTape const& xs) {
+      printTape(os, xs);
+      return os;
+    }
+
+  }; // end of class ChunkedTape
+
+  template<typename T>
+  inline constinit const ChunkedTape<T> empty_chunked_tape{};
+
+  /**
+   * @brief Construct a `ChunkedTape` from input values
+   */
+  class ChunkedTapeConstructor
+    : public Static_callable<ChunkedTapeConstructor> {
+  public:
+    template<typename T, typename... Ts>
+    static auto
+    call(T&& x, Ts&&... xs) {
+      using U = common_type_t<decay_t<T>, decay_t<Ts>...>;
+      return ChunkedTape<U>(
+        vector<U>{U(std::forward<T>(x)), U(std::forward<Ts>(xs))...});
+    }
+  } constexpr chunkedTape{};
+
+} // end of namespace ListProcessing::Dynamic::Details
@@ -0,0 +1,521 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/TList.hpp>
+#include <list_processing/dynamic/Value.hpp>
+#include <list_processing/dynamic/import.hpp>
+
+namespace ListProcessing::Dynamic::Details {
+
+  /**
+   * @brief A tree list slot packed in one tagged word
+   *
+   * @details A slot is nil, a pair, or an atom, like a slot of a
+   * `Construct`, but it is a single pointer-sized word whose two low bits
+   * tell which:
+   *
+   *  - `00`: a pointer to a pair, or nil when the word is zero,
+   *  - `01`: an atom stored in the word itself,
+   *  - `10`: a pointer to an atom stored in its own node,
+   *  - `11`: a string of at most seven characters stored in the word.
+   *
+   * Atoms of at most four bytes are always stored in the word.  Integers
+   * of eight bytes are stored in the word when they fit in 62 bits, and
+   * doubles when the two low bits of their representation are clear,
+   * which holds for every double with a short binary fraction, such as
+   * the integers and the halves.  Other atoms are boxed.
+   *
+   * Pairs and boxes carry an intrusive reference count, so that a pair
+   * takes 24 bytes and an immediate atom none, where a pair of `Construct`
+   * slots and its atoms take a shared control block and a separate
+   * allocation each.  Releasing a long or deeply nested list does not
+   * recurse.
+   */
+  template<typename T>
+  class CompactSlot
+  {
+    static_assert(
+      sizeof(std::uintptr_t) == 8, "CompactSlot requires 64 bit pointers");
+
+    using word_type = std::uintptr_t;
+
+    static constexpr word_type tag_mask = 3;
+    static constexpr word_type pair_tag = 0;
+    static constexpr word_type immediate_tag = 1;
+    static constexpr word_type boxed_tag = 2;
+    static constexpr word_type string_tag = 3;
+
+    static constexpr bool is_string = is_same_v<T, string>;
+
+    struct Node
+    {
+      atomic<std::uint32_t> count{1};
+    };
+
+    struct Pair : Node
+    {
+      Pair(word_type car, word_type cdr)
+        : car(car)
+        , cdr(cdr)
+      {}
+
+      word_type car;
+      word_type cdr;
+    };
+
+    struct Box : Node
+    {
+      explicit Box(T value)
+        : value(std::move(value))
+      {}
+
+      T value;
+    };
+
+    word_type word{0};
+
+    explicit CompactSlot(word_type word, bool)
+      : word(word)
+    {}
+
+    static word_type
+    tagOf(word_type w)
+    {
+      return w & tag_mask;
+    }
+
+    static bool
+    isNode(word_type w)
+    {
+      return w != 0 && (tagOf(w) == pair_tag || tagOf(w) == boxed_tag);
+    }
+
+    static Node*
+    nodeOf(word_type w)
+    {
+      return reinterpret_cast<Node*>(w & ~tag_mask);
+    }
+
+    static Pair const*
+    pairOf(word_type w)
+    {
+      return reinterpret_cast<Pair const*>(w);
+    }
+
+    static Box const*
+    boxOf(word_type w)
+    {
+      return reinterpret_cast<Box const*>(w & ~tag_mask);
+    }
+
+    static void
+    retain(word_type w)
+    {
+      if (isNode(w)) {
+        nodeOf(w)->count.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+
+    static bool
+    drop(word_type w)
+    {
+      return isNode(w) &&
+             nodeOf(w)->count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
+    static void
+    release(word_type w)
+    {
+      if (!drop(w)) {
+        return;
+      }
+      if (tagOf(w) == boxed_tag) {
+        delete boxOf(w);
+        return;
+      }
+      vector<word_type> garbage{w};
+      while (!garbage.empty()) {
+        word_type x = garbage.back();
+        garbage.pop_back();
+        if (tagOf(x) == boxed_tag) {
+          delete boxOf(x);
+        } else {
+          Pair const* p = pairOf(x);
+          if (drop(p->car)) {
+            garbage.push_back(p->car);
+          }
+          if (drop(p->cdr)) {
+            garbage.push_back(p->cdr);
+          }
+          delete p;
+        }
+      }
+    }
+
+    /**
+     * @brief Return the word holding the input atom, if it fits in one
+     */
+    static optional<word_type>
+    immediate(T const& x)
+    {
+      if constexpr (is_string) {
+        if (x.size() <= 7) {
+          word_type w = string_tag | word_type(x.size()) << 2;
+          for (size_t i = 0; i < x.size(); ++i) {
+            auto c = static_cast<unsigned char>(x[i]);
+            w |= word_type(c) << (8 * (i + 1));
+          }
+          return w;
+        }
+      } else if constexpr (
+        std::is_trivially_copyable_v<T> &&
+        (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4)) {
+        return word_type(bit_cast<UnsignedOfSize<sizeof(T)>>(x)) << 2 |
+               immediate_tag;
+      } else if constexpr (is_integral_v<T> && sizeof(T) == 8) {
+        constexpr T limit = T(1) << 61;
+        if ((!is_signed_v<T> || x >= -limit) && x < limit) {
+          return word_type(x) << 2 | immediate_tag;
+        }
+      } else if constexpr (std::is_floating_point_v<T> && sizeof(T) == 8) {
+        auto bits = bit_cast<std::uint64_t>(x);
+        if ((bits & tag_mask) == 0) {
+          return bits | immediate_tag;
+        }
+      }
+      return nullopt;
+    }
+
+    static T
+    fromImmediate(word_type w)
+    {
+      if constexpr (is_string) {
+        string result(size_t(w >> 2 & 7), '\0');
+        for (size_t i = 0; i < result.size(); ++i) {
+          result[i] = char(w >> (8 * (i + 1)) & 0xff);
+        }
+        return result;
+      } else if constexpr (
+        std::is_trivially_copyable_v<T> &&
+        (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4)) {
+        return bit_cast<T>(UnsignedOfSize<sizeof(T)>(w >> 2));
+      } else if constexpr (is_integral_v<T> && sizeof(T) == 8) {
+        if constexpr (is_signed_v<T>) {
+          return T(bit_cast<std::int64_t>(w) >> 2);
+        } else {
+          return T(w >> 2);
+        }
+      } else if constexpr (std::is_floating_point_v<T> && sizeof(T) == 8) {
+        return bit_cast<T>(std::uint64_t(w & ~tag_mask));
+      } else {
+        throw logic_error("CompactSlot has no immediate representation");
+      }
+    }
+
+    static word_type
+    atom(T const& x)
+    {
+      if (auto w = immediate(x)) {
+        return *w;
+      }
+      return reinterpret_cast<word_type>(new Box(x)) | boxed_tag;
+    }
+
+    static T
+    valueOf(word_type w)
+    {
+      switch (tagOf(w)) {
+        case immediate_tag:
+        case string_tag:
+          return fromImmediate(w);
+        case boxed_tag:
+          return boxOf(w)->value;
+        default:
+          throw logic_error("CompactSlot does not hold an atom");
+      }
+    }
+
+  public:
+    using value_type = T;
+
+    /**
+     * @brief Construct the empty list
+     */
+    CompactSlot() = default;
+
+    /**
+     * @brief Construct an atom
+     */
+    CompactSlot(T const& x)
+      : word(atom(x))
+    {}
+
+    CompactSlot(CompactSlot const& input)
+      : word(input.word)
+    {
+      retain(word);
+    }
+
+    CompactSlot(CompactSlot&& input) noexcept
+      : word(std::exchange(input.word, 0))
+    {}
+
+    CompactSlot&
+    operator=(CompactSlot input) noexcept
+    {
+      std::swap(word, input.word);
+      return *this;
+    }
+
+    ~CompactSlot() { release(word); }
+
+    /**
+     * @brief Return a pair of the input slots
+     */
+    static CompactSlot
+    cons(CompactSlot car, CompactSlot cdr)
+    {
+      auto p = new Pair(car.word, cdr.word);
+      car.word = cdr.word = 0;
+      return CompactSlot(reinterpret_cast<word_type>(p), true);
+    }
+
+    bool
+    isNil() const
+    {
+      return word == 0;
+    }
+
+    friend bool
+    isnil(CompactSlot const& x)
+    {
+      return x.isNil();
+    }
+
+    bool
+    isPair() const
+    {
+      return word != 0 && tagOf(word) == pair_tag;
+    }
+
+    friend bool
+    ispair(CompactSlot const& x)
+    {
+      return x.isPair();
+    }
+
+    bool
+    isAtom() const
+    {
+      return tagOf(word) != pair_tag;
+    }
+
+    friend bool
+    isatom(CompactSlot const& x)
+    {
+      return x.isAtom();
+    }
+
+    /**
+     * @brief Return true if the slot is an atom stored in the slot itself
+     */
+    bool
+    isImmediate() const
+    {
+      return tagOf(word) == immediate_tag || tagOf(word) == string_tag;
+    }
+
+    /**
+     * @brief Return the atom in the slot
+     */
+    T
+    value() const
+    {
+      return valueOf(word);
+    }
+
+    friend T
+    value(CompactSlot const& x)
+    {
+      return x.value();
+    }
+
+    friend CompactSlot
+    car(CompactSlot const& x)
+    {
+      if (!x.isPair()) {
+        throw logic_error("Cannot access the head of an empty list");
+      }
+      word_type w = pairOf(x.word)->car;
+      retain(w);
+      return CompactSlot(w, true);
+    }
+
+    friend CompactSlot
+    cdr(CompactSlot const& x)
+    {
+      if (x.isNil()) {
+        return x;
+      }
+      if (!x.isPair()) {
+        throw logic_error("Atom does not have a cdr");
+      }
+      word_type w = pairOf(x.word)->cdr;
+      retain(w);
+      return CompactSlot(w, true);
+    }
+
+    friend CompactSlot
+    cadr(CompactSlot const& x)
+    {
+      return car(cdr(x));
+    }
+
+    /**
+     * @brief Return true if the slots hold equal trees
+     */
+    friend bool
+    operator==(CompactSlot const& x, CompactSlot const& y)
+    {
+      vector<pair<word_type, word_type>> pending{{x.word, y.word}};
+      while (!pending.empty()) {
+        auto [u, v] = pending.back();
+        pending.pop_back();
+        if (u == v) {
+          continue;
+        }
+        if (tagOf(u) == pair_tag && tagOf(v) == pair_tag) {
+          if (u == 0 || v == 0) {
+            return false;
+          }
+          pending.emplace_back(pairOf(u)->cdr, pairOf(v)->cdr);
+          pending.emplace_back(pairOf(u)->car, pairOf(v)->car);
+        } else if (
+          tagOf(u) == pair_tag || tagOf(v) == pair_tag ||
+          valueOf(u) != valueOf(v)) {
+          return false;
+        }
+      }
+      return true;
+    }
+  };
+
+  /**
+   * @brief Return a compact list of the inputs, each an atom or a slot
+   */
+  template<typename T, typename... Xs>
+  CompactSlot<T>
+  compactList(Xs const&... xs)
+  {
+    array<CompactSlot<T>, sizeof...(Xs)> slots{CompactSlot<T>(xs)...};
+    CompactSlot<T> result{};
+    for (size_t i = slots.size(); i > 0; --i) {
+      result =
+        CompactSlot<T>::cons(std::move(slots[i - 1]), std::move(result));
+    }
+    return result;
+  }
+
+  /**
+   * @brief Return the compact form of a tree list slot
+   *
+   * @details The lists nested in cars are converted from an explicit
+   * stack, so that a deeply nested list does not exhaust the stack.
+   */
+  template<typename T>
+  CompactSlot<T>
+  toCompact(typename Construct<T>::Slot const& x)
+  {
+    using Slot = typename Construct<T>::Slot;
+    struct Frame
+    {
+      vector<CompactSlot<T>> cars;
+      Slot rest;
+    };
+    if (holds_alternative<Shared<T>>(x)) {
+      return CompactSlot<T>(*get<Shared<T>>(x));
+    }
+    vector<Frame> stack{};
+    stack.push_back(Frame{{}, x});
+    while (true) {
+      Frame& frame = stack.back();
+      if (ispair(frame.rest)) {
+        Slot head = car(frame.rest);
+        frame.rest = cdr(get<Construct<T>>(frame.rest));
+        if (holds_alternative<Shared<T>>(head)) {
+          frame.cars.push_back(CompactSlot<T>(*get<Shared<T>>(head)));
+        } else {
+          stack.push_back(Frame{{}, std::move(head)});
+        }
+        continue;
+      }
+      CompactSlot<T> result =
+        holds_alternative<Shared<T>>(frame.rest)
+          ? CompactSlot<T>(*get<Shared<T>>(frame.rest))
+          : CompactSlot<T>();
+      for (auto y = frame.cars.rbegin(); y != frame.cars.rend(); ++y) {
+        result = CompactSlot<T>::cons(std::move(*y), std::move(result));
+      }
+      stack.pop_back();
+      if (stack.empty()) {
+        return result;
+      }
+      stack.back().cars.push_back(std::move(result));
+    }
+  }
+
+  template<typename T>
+  CompactSlot<T>
+  toCompact(Construct<T> const& xs)
+  {
+    return toCompact<T>(typename Construct<T>::Slot(xs));
+  }
+
+  /**
+   * @brief Return the tree list slot with the input compact form
+   *
+   * @details Like `toCompact`, this does not recurse.
+   */
+  template<typename T>
+  typename Construct<T>::Slot
+  fromCompact(CompactSlot<T> const& x)
+  {
+    using Slot = typename Construct<T>::Slot;
+    struct Frame
+    {
+      vector<Slot> cars;
+      CompactSlot<T> rest;
+    };
+    if (x.isAtom()) {
+      return Slot(Shared<T>(x.value()));
+    }
+    vector<Frame> stack{};
+    stack.push_back(Frame{{}, x});
+    while (true) {
+      Frame& frame = stack.back();
+      if (frame.rest.isPair()) {
+        CompactSlot<T> head = car(frame.rest);
+        frame.rest = cdr(frame.rest);
+        if (head.isAtom()) {
+          frame.cars.push_back(Slot(Shared<T>(head.value())));
+        } else {
+          stack.push_back(Frame{{}, std::move(head)});
+        }
+        continue;
+      }
+      Slot result = frame.rest.isAtom() ? Slot(Shared<T>(frame.rest.value()))
+                                        : Slot(Construct<T>());
+      for (auto y = frame.cars.rbegin(); y != frame.cars.rend(); ++y) {
+        result = Slot(Construct<T>(std::move(*y), std::move(result)));
+      }
+      stack.pop_back();
+      if (stack.empty()) {
+        return result;
+      }
+      stack.back().cars.push_back(std::move(result));
+    }
+  }
+
+} // end of namespace ListProcessing::Dynamic::Details
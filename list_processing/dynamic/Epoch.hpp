@@ -0,0 +1,233 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/import.hpp>
+
+namespace ListProcessing::Dynamic::Details {
+
+  /**
+   * @brief Epoch-based reclamation of shared, read-mostly objects.
+   *
+   * @details A thread that reads an object published through an
+   * atomic pointer first pins the current epoch with a `Guard`.  A
+   * writer that unpublishes an object hands it to `retire` instead of
+   * destroying it.  Retired objects are destroyed in batches, once the
+   * global epoch has advanced twice past the epoch in which they were
+   * retired, which can only happen after every reader that might still
+   * hold a pointer to them has released its guard.  Readers therefore
+   * never touch a reference count, and writers never wait for readers.
+   */
+  class Epoch {
+  public:
+    using epoch_type = std::uint64_t;
+
+    /**
+     * @brief The number of retirements on a thread between attempts to
+     * advance the epoch and reclaim that thread's retired objects.
+     */
+    static constexpr size_type collect_period = 64;
+
+  private:
+    static constexpr epoch_type quiescent = ~epoch_type(0);
+
+    struct Retired {
+      epoch_type epoch;
+      void* object;
+      void (*deleter)(void*);
+    };
+
+    struct Record {
+      atomic<epoch_type> announced{quiescent};
+      atomic<bool> in_use{true};
+      size_type nesting{0};
+      size_type retirements{0};
+      vector<Retired> retired{};
+      Record* next{nullptr};
+    };
+
+    struct Domain {
+      atomic<epoch_type> epoch{0};
+      atomic<Record*> records{nullptr};
+      mutex orphans_mutex{};
+      vector<Retired> orphans{};
+
+      ~Domain() {
+        for (Retired& x : orphans) {
+          x.deleter(x.object);
+        }
+        Record* record = records.load();
+        while (record) {
+          Record* next = record->next;
+          for (Retired& x : record->retired) {
+            x.deleter(x.object);
+          }
+          delete record;
+          record = next;
+        }
+      }
+    };
+
+    static Domain&
+    domain() {
+      static Domain instance{};
+      return instance;
+    }
+
+    /**
+     * @brief Claim a thread record, reusing one released by an exited
+     * thread when possible.
+     */
+    static Record*
+    acquire() {
+      Domain& d = domain();
+      for (Record* record = d.records.load(std::memory_order_acquire); record;
+           record = record->next) {
+        bool expected = false;
+        if (record->in_use.compare_exchange_strong(expected, true)) {
+          return record;
+        }
+      }
+      Record* record = new Record{};
+      Record* head = d.records.load(std::memory_order_relaxed);
+      do {
+        record->next = head;
+      } while (!d.records.compare_exchange_weak(
+        head, record, std::memory_order_release, std::memory_order_relaxed));
+      return record;
+    }
+
+    /**
+     * @brief Release a thread record when its thread exits, handing any
+     * objects that are still waiting to the domain.
+     */
+    static void
+    release(Record* record) {
+      collect(*record);
+      if (!record->retired.empty()) {
+        Domain& d = domain();
+        lock_guard lock{d.orphans_mutex};
+        d.orphans.insert(
+          d.orphans.end(), record->retired.begin(), record->retired.end());
+        record->retired.clear();
+      }
+      record->retirements = 0;
+      record->in_use.store(false, std::memory_order_release);
+    }
+
+    struct Local {
+      Record* record{acquire()};
+      ~Local() { release(record); }
+    };
+
+    static Record&
+    local() {
+      thread_local Local instance{};
+      return *instance.record;
+    }
+
+    /**
+     * @brief Advance the global epoch if every pinned thread has
+     * observed the current one, and return the global epoch.
+     */
+    static epoch_type
+    tryAdvance() {
+      Domain& d = domain();
+      epoch_type current = d.epoch.load();
+      for (Record* record = d.records.load(); record; record = record->next) {
+        epoch_type announced = record->announced.load();
+        if (announced != quiescent && announced != current) {
+          return current;
+        }
+      }
+      d.epoch.compare_exchange_strong(current, current + 1);
+      return d.epoch.load();
+    }
+
+    static void
+    reclaim(vector<Retired>& retired, epoch_type current) {
+      auto boundary = std::partition(
+        retired.begin(), retired.end(), [=](Retired const& x) {
+          return x.epoch + 2 > current;
+        });
+      vector<Retired> ready(boundary, retired.end());
+      retired.erase(boundary, retired.end());
+      for (Retired& x : ready) {
+        x.deleter(x.object);
+      }
+    }
+
+    static void
+    collect(Record& record) {
+      epoch_type current = tryAdvance();
+      reclaim(record.retired, current);
+      Domain& d = domain();
+      std::unique_lock lock{d.orphans_mutex, std::try_to_lock};
+      if (lock.owns_lock()) {
+        reclaim(d.orphans, current);
+      }
+    }
+
+  public:
+    /**
+     * @brief An RAII pin of the current epoch on the calling thread.
+     *
+     * @details While a guard exists, no object that the thread could have
+     * loaded from a published pointer is destroyed.  Guards nest.
+     */
+    class Guard {
+    public:
+      Guard()
+        : record{local()} {
+        if (record.nesting++ == 0) {
+          record.announced.store(domain().epoch.load());
+          std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+      }
+
+      Guard(Guard const&) = delete;
+
+      Guard&
+      operator=(Guard const&) = delete;
+
+      ~Guard() {
+        if (--record.nesting == 0) {
+          record.announced.store(quiescent, std::memory_order_release);
+        }
+      }
+
+    private:
+      Record& record;
+    };
+
+    /**
+     * @brief Defer destruction of an object that is no longer reachable
+     * from any published pointer until no reader can still observe it.
+     */
+    template<typename T>
+    static void
+    retire(T const* object) {
+      if (object) {
+        Record& record = local();
+        record.retired.push_back(Retired{
+          domain().epoch.load(),
+          const_cast<void*>(static_cast<void const*>(object)),
+          [](void* x) { delete static_cast<T*>(x); }});
+        if (++record.retirements % collect_period == 0) {
+          collect(record);
+        }
+      }
+    }
+
+    /**
+     * @brief Try to reclaim the objects retired by the calling thread.
+     */
+    static void
+    collect() {
+      collect(local());
+    }
+
+  }; // end of class Epoch
+
+} // end of namespace ListProcessing::Dynamic::Details
@@ -0,0 +1,211 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/Epoch.hpp>
+#include <list_processing/dynamic/import.hpp>
+
+namespace ListProcessing::Dynamic::Details {
+
+  /**
+   * @brief A thread-safe, mutable reference to a persistent value with
+   * epoch-based reclamation of replaced snapshots.
+   *
+   * @details An `EpochAtom` provides the same publication operations as
+   * `Atom`, but readers that use `read` borrow the current snapshot
+   * instead of copying it, so a read touches no reference count at all:
+   * not the atom's and, because traversals such as `doList` walk the nodes
+   * through raw pointers, not those of the nodes either.  Replaced
+   * snapshots are handed to `Epoch::retire` and destroyed in batches once
+   * no reader can still observe them.
+   *
+   * @tparam T - a type parameter specifying the type of the snapshots
+   */
+  template<typename T>
+  class EpochAtom {
+  public:
+    using value_type = T;
+    using const_reference = value_type const&;
+
+    EpochAtom()
+      : ptr{new value_type{}} {}
+
+    explicit EpochAtom(value_type x)
+      : ptr{new value_type{std::move(x)}} {}
+
+    EpochAtom(EpochAtom const&) = delete;
+
+    EpochAtom&
+    operator=(EpochAtom const&) = delete;
+
+    ~EpochAtom() { delete ptr.load(); }
+
+  private:
+    using pointer = value_type const*;
+
+    atomic<pointer> ptr;
+
+  public:
+    /**
+     * @brief Return the result of applying the input function to the
+     * current snapshot, which is borrowed for the duration of the call.
+     *
+     * @details The reference passed to the function must not escape it.
+     */
+    template<invocable<const_reference> F>
+    auto
+    read(F f) const {
+      Epoch::Guard guard{};
+      return f(*ptr.load(std::memory_order_acquire));
+    }
+
+    /**
+     * @brief Return the result of applying the input function to the
+     * current snapshot held by the input atom.
+     */
+    template<invocable<const_reference> F>
+    friend auto
+    read(EpochAtom const& atom, F f) {
+      return atom.read(f);
+    }
+
+    /**
+     * @brief Return a copy of the current snapshot held by this atom.
+     */
+    value_type
+    load() const {
+      return read([](const_reference x) { return x; });
+    }
+
+    /**
+     * @brief Return a copy of the current snapshot held by the input atom.
+     */
+    friend value_type
+    load(EpochAtom const& atom) {
+      return atom.load();
+    }
+
+    /**
+     * @brief Replace the snapshot held by this atom.
+     */
+    void
+    store(value_type x) {
+      Epoch::retire(ptr.exchange(
+        new value_type{std::move(x)}, std::memory_order_acq_rel));
+    }
+
+    /**
+     * @brief Replace the snapshot held by the input atom.
+     */
+    friend void
+    store(EpochAtom& atom, value_type x) {
+      atom.store(std::move(x));
+    }
+
+    /**
+     * @brief Replace the snapshot held by this atom and return the
+     * snapshot that it replaced.
+     */
+    value_type
+    exchange(value_type x) {
+      Epoch::Guard guard{};
+      pointer old =
+        ptr.exchange(new value_type{std::move(x)}, std::memory_order_acq_rel);
+      value_type result = *old;
+      Epoch::retire(old);
+      return result;
+    }
+
+    /**
+     * @brief Replace the snapshot held by the input atom and return the
+     * snapshot that it replaced.
+     */
+    friend value_type
+    exchange(EpochAtom& atom, value_type x) {
+      return atom.exchange(std::move(x));
+    }
+
+    /**
+     * @brief Replace the snapshot held by this atom with `desired` if the
+     * current snapshot is equal to `expected`.
+     *
+     * @details Return true if the snapshot was replaced.  Otherwise,
+     * `expected` is updated with the current snapshot and false is returned.
+     */
+    bool
+    compareExchange(value_type& expected, value_type desired)
+      requires equality_comparable<value_type>
+    {
+      Epoch::Guard guard{};
+      pointer current = ptr.load(std::memory_order_acquire);
+      unique_ptr<value_type const> next{new value_type{std::move(desired)}};
+      while (*current == expected) {
+        if (ptr.compare_exchange_weak(
+              current,
+              next.get(),
+              std::memory_order_acq_rel,
+              std::memory_order_acquire)) {
+          next.release();
+          Epoch::retire(current);
+          return true;
+        }
+      }
+      expected = *current;
+      return false;
+    }
+
+    /**
+     * @brief Replace the snapshot held by the input atom with `desired` if
+     * the current snapshot is equal to `expected`.
+     */
+    friend bool
+    compareExchange(EpochAtom& atom, value_type& expected, value_type desired)
+      requires equality_comparable<value_type>
+    {
+      return atom.compareExchange(expected, std::move(desired));
+    }
+
+    /**
+     * @brief Replace the snapshot held by this atom with the result of
+     * applying the input function to it, and return the new snapshot.
+     *
+     * @details The function may be called more than once when other
+     * writers race with this one, so it should be free of side effects.
+     */
+    template<invocable<const_reference> F>
+    value_type
+    swap(F f) {
+      Epoch::Guard guard{};
+      pointer current = ptr.load(std::memory_order_acquire);
+      unique_ptr<value_type const> next{new value_type{f(*current)}};
+      pointer seen = current;
+      while (!ptr.compare_exchange_weak(
+        current,
+        next.get(),
+        std::memory_order_acq_rel,
+        std::memory_order_acquire)) {
+        if (current != seen) {
+          next.reset(new value_type{f(*current)});
+          seen = current;
+        }
+      }
+      value_type result = *next;
+      next.release();
+      Epoch::retire(current);
+      return result;
+    }
+
+    /**
+     * @brief Replace the snapshot held by the input atom with the result of
+     * applying the input function to it, and return the new snapshot.
+     */
+    template<invocable<const_reference> F>
+    friend value_type
+    swap(EpochAtom& atom, F f) {
+      return atom.swap(f);
+    }
+
+  }; // end of class EpochAtom
+
+} // end of namespace ListProcessing::Dynamic::Details
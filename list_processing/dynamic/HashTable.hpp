@@ -11,6 +11,18 @@
 
 namespace ListProcessing::Dynamic::Details {
 
+  /**
+   * @brief A persistent hash table
+   *
+   * @details The table is a hash array mapped trie: each level of the
+   * trie consumes `BinSizeExponent` bits of the hash of a key, and a
+   * branch stores only its populated slots, contiguously, with a bitmap
+   * recording which slots they are.  Lookup, insertion and removal take
+   * time proportional to the depth of the trie, which is logarithmic in
+   * the size with base `bin_size`, and an update copies only the path to
+   * the affected slot.  Keys whose hashes are equal are kept together in
+   * a collision branch at the bottom of the trie.
+   */
   template<
     typename Key,
     typename Mapped,
@@ -20,12 +32,13 @@ namespace ListProcessing::Dynamic::Details {
   {
 
     static_assert(BinSizeExponent > 0, "BinSizeExponent must be positive");
+    static_assert(BinSizeExponent <= 6, "BinSizeExponent must be at most 6");
 
   public:
     using key_type = Key;
     using key_const_reference = key_type const&;
     using mapped_type = Mapped;
-    using mapped_const_reference = mapped_type&;
+    using mapped_const_reference = mapped_type const&;
     using value_type = pair<key_type, mapped_type>;
     using const_reference = value_type const&;
 
@@ -35,14 +48,286 @@ namespace ListProcessing::Dynamic::Details {
     HashTable() = default;
     HashTable(HashTable const&) = default;
 
-    HashTable(initializer_list<value_type> const&)
-      : pkernel(make_shared<Kernel>())
+    HashTable(initializer_list<value_type> const& values)
+    {
+      for (const_reference value : values) {
+        *this = set(value.first, value.second);
+      }
+    }
+
+  private:
+    struct Node;
+    using pointer = shared_ptr<const Node>;
+    using hash_type = std::uint64_t;
+    using bitmap_type = std::uint64_t;
+    using Slot = variant<value_type, pointer>;
+
+    static constexpr size_type hash_bits = 8 * sizeof(hash_type);
+
+    /**
+     * @brief A branch of the trie, or a collision branch when it is
+     * below the last level consuming hash bits.
+     */
+    struct Node
+    {
+      bitmap_type bitmap;
+      vector<Slot> slots;
+    };
+
+    pointer root{};
+    size_type count{0};
+
+    HashTable(pointer root, size_type count)
+      : root(root)
+      , count(count)
     {}
 
+    static hash_type
+    hashOf(key_const_reference key)
+    {
+      return hash_type(std::hash<key_type>{}(key));
+    }
+
+    static bitmap_type
+    bitOf(hash_type h, size_type shift)
+    {
+      return bitmap_type(1) << ((h >> shift) & (bin_size - 1));
+    }
+
+    static index_type
+    positionOf(bitmap_type bitmap, bitmap_type bit)
+    {
+      return std::popcount(bitmap & (bit - 1));
+    }
+
+    static pointer
+    makeNode(bitmap_type bitmap, vector<Slot> slots)
+    {
+      return make_shared<const Node>(Node{bitmap, std::move(slots)});
+    }
+
+    /**
+     * @brief Return a branch holding two values with different keys
+     */
+    static pointer
+    makePair(
+      size_type shift,
+      const_reference x,
+      hash_type hx,
+      const_reference y,
+      hash_type hy)
+    {
+      if (shift >= hash_bits) {
+        return makeNode(0, {Slot(x), Slot(y)});
+      }
+      bitmap_type bx = bitOf(hx, shift);
+      bitmap_type by = bitOf(hy, shift);
+      if (bx == by) {
+        return makeNode(
+          bx, {Slot(makePair(shift + bin_size_exponent, x, hx, y, hy))});
+      }
+      return bx < by ? makeNode(bx | by, {Slot(x), Slot(y)})
+                     : makeNode(bx | by, {Slot(y), Slot(x)});
+    }
+
+    static value_type const*
+    find(pointer const& node, key_const_reference key)
+    {
+      hash_type h = hashOf(key);
+      Node const* p = node.get();
+      for (size_type shift = 0; p; shift += bin_size_exponent) {
+        if (shift >= hash_bits) {
+          for (Slot const& slot : p->slots) {
+            value_type const& value = std::get<value_type>(slot);
+            if (value.first == key) {
+              return &value;
+            }
+          }
+          return nullptr;
+        }
+        bitmap_type bit = bitOf(h, shift);
+        if (!(p->bitmap & bit)) {
+          return nullptr;
+        }
+        Slot const& slot = p->slots[positionOf(p->bitmap, bit)];
+        if (holds_alternative<value_type>(slot)) {
+          value_type const& value = std::get<value_type>(slot);
+          return value.first == key ? &value : nullptr;
+        }
+        p = std::get<pointer>(slot).get();
+      }
+      return nullptr;
+    }
+
+    static pointer
+    setAux(
+      pointer const& node,
+      size_type shift,
+      hash_type h,
+      const_reference value,
+      bool& added)
+    {
+      if (!node) {
+        added = true;
+        return makeNode(bitOf(h, shift), {Slot(value)});
+      }
+      vector<Slot> slots = node->slots;
+      if (shift >= hash_bits) {
+        for (Slot& slot : slots) {
+          if (std::get<value_type>(slot).first == value.first) {
+            slot = value;
+            return makeNode(0, std::move(slots));
+          }
+        }
+        added = true;
+        slots.push_back(value);
+        return makeNode(0, std::move(slots));
+      }
+
+      bitmap_type bit = bitOf(h, shift);
+      index_type position = positionOf(node->bitmap, bit);
+      if (!(node->bitmap & bit)) {
+        added = true;
+        slots.insert(slots.begin() + position, Slot(value));
+        return makeNode(node->bitmap | bit, std::move(slots));
+      }
+
+      Slot& slot = slots[position];
+      if (holds_alternative<pointer>(slot)) {
+        slot = setAux(
+          std::get<pointer>(slot), shift + bin_size_exponent, h, value, added);
+      } else if (std::get<value_type>(slot).first == value.first) {
+        slot = value;
+      } else {
+        added = true;
+        value_type existing = std::get<value_type>(slot);
+        slot = makePair(
+          shift + bin_size_exponent,
+          existing,
+          hashOf(existing.first),
+          value,
+          h);
+      }
+      return makeNode(node->bitmap, std::move(slots));
+    }
+
+    /**
+     * @brief Return the node without the input key, which may be null
+     * when the node becomes empty, or a node with a single value when a
+     * value should be lifted into the parent.
+     */
+    static pointer
+    removeAux(
+      pointer const& node,
+      size_type shift,
+      hash_type h,
+      key_const_reference key,
+      bool& removed)
+    {
+      vector<Slot> slots = node->slots;
+      bitmap_type bitmap = node->bitmap;
+      if (shift >= hash_bits) {
+        auto position = std::find_if(slots.begin(), slots.end(), [&](auto& s) {
+          return std::get<value_type>(s).first == key;
+        });
+        if (position == slots.end()) {
+          return node;
+        }
+        removed = true;
+        slots.erase(position);
+      } else {
+        bitmap_type bit = bitOf(h, shift);
+        if (!(bitmap & bit)) {
+          return node;
+        }
+        index_type position = positionOf(bitmap, bit);
+        Slot& slot = slots[position];
+        if (holds_alternative<value_type>(slot)) {
+          if (!(std::get<value_type>(slot).first == key)) {
+            return node;
+          }
+          removed = true;
+          slots.erase(slots.begin() + position);
+          bitmap &= ~bit;
+        } else {
+          pointer child = removeAux(
+            std::get<pointer>(slot),
+            shift + bin_size_exponent,
+            h,
+            key,
+            removed);
+          if (!removed) {
+            return node;
+          }
+          if (!child) {
+            slots.erase(slots.begin() + position);
+            bitmap &= ~bit;
+          } else if (isSingleValue(child)) {
+            slot = child->slots.front();
+          } else {
+            slot = child;
+          }
+        }
+      }
+      return slots.empty() ? pointer{} : makeNode(bitmap, std::move(slots));
+    }
+
+    static bool
+    isSingleValue(pointer const& node)
+    {
+      return node->slots.size() == 1 &&
+             holds_alternative<value_type>(node->slots.front());
+    }
+
+    template<typename F>
+    static void
+    doEntriesAux(pointer const& node, F& f)
+    {
+      if (!node) {
+        return;
+      }
+      for (Slot const& slot : node->slots) {
+        if (holds_alternative<value_type>(slot)) {
+          f(std::get<value_type>(slot));
+        } else {
+          doEntriesAux(std::get<pointer>(slot), f);
+        }
+      }
+    }
+
+    template<typename F>
+    auto
+    listOf(F f) const
+    {
+      using U = decay_t<invoke_result_t<F, const_reference>>;
+      vector<value_type const*> values{};
+      doEntries(*this, [&](const_reference x) { values.push_back(&x); });
+      List<U> result{};
+      for (auto x = values.rbegin(); x != values.rend(); ++x) {
+        result = cons(U(f(**x)), result);
+      }
+      return result;
+    }
+
+    template<typename F>
+    auto
+    streamOf(F f) const
+    {
+      using U = decay_t<invoke_result_t<F, const_reference>>;
+      vector<value_type const*> values{};
+      doEntries(*this, [&](const_reference x) { values.push_back(&x); });
+      Stream<U> result{};
+      for (auto x = values.rbegin(); x != values.rend(); ++x) {
+        result = Stream<U>(U(f(**x)), result);
+      }
+      return result;
+    }
+
+  public:
     bool
     hasData() const
     {
-      return bool(pkernel);
+      return bool(root);
     }
 
     friend bool
@@ -63,93 +348,190 @@ namespace ListProcessing::Dynamic::Details {
       return xs.isEmpty();
     }
 
-    mapped_const_reference get(key_const_reference) const
+    /**
+     * @brief Return `true` if this table has the input key
+     */
+    bool
+    hasKey(key_const_reference key) const
     {
-      throw logic_error("not implemented");
-      return *this;
+      return find(root, key) != nullptr;
     }
 
+    friend bool
+    hasKey(key_const_reference key, HashTable const& xs)
+    {
+      return xs.hasKey(key);
+    }
+
+    /**
+     * @brief Return the value associated with the input key, throwing
+     * `logic_error` if this table does not have the key
+     */
     mapped_const_reference
-    forceGet(key_const_reference, mapped_const_reference alternate) const
+    get(key_const_reference key) const
+    {
+      value_type const* value = find(root, key);
+      if (!value) {
+        throw logic_error("HashTable does not have requested key!");
+      }
+      return value->second;
+    }
+
+    mapped_type
+    tryGet(key_const_reference key) const
+    {
+      return get(key);
+    }
+
+    friend mapped_type
+    tryGet(key_const_reference key, HashTable const& xs)
     {
-      throw logic_error("not implemented");
-      return alternate;
+      return xs.get(key);
     }
 
-    optional<mapped_type> maybeGet(key_const_reference) const
+    mapped_type
+    forceGet(key_const_reference key, mapped_const_reference alternate) const
     {
-      throw logic_error("not implemented");
-      return {};
+      value_type const* value = find(root, key);
+      return value ? value->second : alternate;
     }
 
-    HashTable set(key_const_reference, mapped_const_reference) const
+    friend mapped_type
+    forceGet(
+      key_const_reference key,
+      mapped_const_reference alternate,
+      HashTable const& xs)
     {
-      throw logic_error("not implemented");
-      return *this;
+      return xs.forceGet(key, alternate);
     }
 
-    HashTable remove(key_const_reference) const
+    optional<mapped_type>
+    maybeGet(key_const_reference key) const
     {
-      throw logic_error("not implemented");
-      return *this;
+      value_type const* value = find(root, key);
+      return value ? optional<mapped_type>(value->second) : nullopt;
+    }
+
+    friend optional<mapped_type>
+    maybeGet(key_const_reference key, HashTable const& xs)
+    {
+      return xs.maybeGet(key);
+    }
+
+    /**
+     * @brief Return a table like this table, with the input value
+     * associated with the input key
+     */
+    HashTable
+    set(key_const_reference key, mapped_const_reference value) const
+    {
+      bool added = false;
+      pointer result = setAux(root, 0, hashOf(key), {key, value}, added);
+      return HashTable(result, count + (added ? 1 : 0));
+    }
+
+    friend HashTable
+    set(
+      key_const_reference key,
+      mapped_const_reference value,
+      HashTable const& xs)
+    {
+      return xs.set(key, value);
+    }
+
+    /**
+     * @brief Return a table like this table, without the input key
+     */
+    HashTable
+    remove(key_const_reference key) const
+    {
+      if (!root) {
+        return *this;
+      }
+      bool removed = false;
+      pointer result = removeAux(root, 0, hashOf(key), key, removed);
+      return removed ? HashTable(result, count - 1) : *this;
+    }
+
+    friend HashTable
+    remove(key_const_reference key, HashTable const& xs)
+    {
+      return xs.remove(key);
+    }
+
+    HashTable
+    unset(key_const_reference key) const
+    {
+      return remove(key);
+    }
+
+    friend HashTable
+    unset(key_const_reference key, HashTable const& xs)
+    {
+      return xs.remove(key);
+    }
+
+    /**
+     * @brief Call a function with each association of the input table,
+     * by reference, in an unspecified order
+     */
+    template<typename F>
+    friend F
+    doEntries(HashTable const& xs, F f)
+    {
+      doEntriesAux(xs.root, f);
+      return f;
     }
 
     AList<key_type, mapped_type>
     toAList() const
     {
-      throw logic_error("not implemented");
-      return {};
+      return AList<key_type, mapped_type>(
+        listOf([](const_reference x) { return x; }));
     }
 
     Stream<value_type>
     toStream() const
     {
-      throw logic_error("not implemented");
-      return {};
+      return streamOf([](const_reference x) { return x; });
     }
 
     List<key_type>
     keys() const
     {
-      throw logic_error("not implemented");
-      return {};
+      return listOf([](const_reference x) { return x.first; });
     }
 
     List<mapped_type>
     values() const
     {
-      throw logic_error("not implemented");
-      return {};
+      return listOf([](const_reference x) { return x.second; });
     }
 
     Stream<key_type>
     inKeys() const
     {
-      throw logic_error("not implemented");
-      return {};
+      return streamOf([](const_reference x) { return x.first; });
     }
 
     Stream<mapped_type>
     inValues() const
     {
-      throw logic_error("not implemented");
-      return {};
+      return streamOf([](const_reference x) { return x.second; });
     }
 
     size_type
     size() const
     {
-      throw logic_error("not implemented");
-      return 0;
+      return count;
     }
 
-  private:
-    class Kernel
-    {};
-
-    using kernel_pointer = shared_ptr<Kernel>;
-    kernel_pointer pkernel;
-  }; // end of class HasData
+    friend size_type
+    length(HashTable const& xs)
+    {
+      return xs.size();
+    }
+  }; // end of class HashTable
 
   template<typename Key, typename Mapped>
   HashTable(initializer_list<pair<Key, Mapped>>) -> HashTable<Key, Mapped>;
@@ -16,30 +16,117 @@ namespace ListProcessing::Dynamic::Details {
   template<typename T>
   using Thunk = function<T()>;
 
+  /**
+   * @brief A value computed on first use
+   *
+   * @details Copies of a lazy value share one kernel, allocated once,
+   * which holds the thunk itself rather than a `std::function`, and the
+   * value once it is computed.  The value is computed at most once, even
+   * when several threads force it at the same time: the first to force
+   * it runs the thunk and the others wait on the kernel's state, without
+   * a lock, until the value is published.  Forcing a computed value is a
+   * single acquire load.  If the thunk throws, the exception reaches the
+   * thread that ran it, and the next force runs the thunk again.  The
+   * thunk, with anything it captured, is released once the value is
+   * computed.
+   */
   template<typename T>
   class Lazy {
     using thunk_type = Thunk<T>;
-    using variant_type = variant<T, thunk_type>;
-    using pointer_type = shared_ptr<variant_type>;
 
-    mutable pointer_type ptr;
+    enum State : unsigned char { pending, running, ready };
+
+    struct Kernel {
+      explicit Kernel(State state) : state(state) {}
+
+      virtual ~Kernel() = default;
+
+      // Run the thunk into `value` and release it.  Only the thread
+      // that moved the state from `pending` to `running` calls this.
+      virtual void
+      compute() = 0;
+
+      atomic<State> state;
+      optional<T> value{};
+    };
+
+    struct ValueKernel final : Kernel {
+      explicit ValueKernel(T x) : Kernel(ready) {
+        this->value.emplace(std::move(x));
+      }
+
+      void
+      compute() override {}
+    };
+
+    template<typename F>
+    struct ThunkKernel final : Kernel {
+      explicit ThunkKernel(F f) : Kernel(pending), f(std::move(f)) {}
+
+      void
+      compute() override {
+        this->value.emplace((*f)());
+        f.reset();
+      }
+
+      optional<F> f;
+    };
+
+    shared_ptr<Kernel> ptr;
+
   public:
 
     using value_type = T;
 
-    Lazy(T x) : ptr{make_shared<variant_type>(std::move(x))} {}
+    Lazy(T x) : ptr{make_shared<ValueKernel>(std::move(x))} {}
 
-    Lazy(thunk_type f) : ptr{make_shared<variant_type>(std::move(f))} {}
+    template<thunk F>
+      requires(!convertible_to<F, T> &&
+               convertible_to<std::invoke_result_t<F&>, T>)
+    Lazy(F f) : ptr{make_shared<ThunkKernel<F>>(std::move(f))} {}
 
     operator const T& () const {
-      return holds_alternative<thunk_type>(*ptr)
-	? reify()
-	: get<value_type>(*ptr);
+      return force();
+    }
+
+    /**
+     * @brief Return the value, computing it if this is the first use
+     */
+    const T&
+    force() const {
+      Kernel& k = *ptr;
+      State s = k.state.load(std::memory_order_acquire);
+      while (s != ready) {
+        if (s == pending &&
+            k.state.compare_exchange_weak(
+              s, running, std::memory_order_acquire)) {
+          try {
+            k.compute();
+          } catch (...) {
+            k.state.store(pending, std::memory_order_release);
+            k.state.notify_all();
+            throw;
+          }
+          k.state.store(ready, std::memory_order_release);
+          k.state.notify_all();
+          break;
+        }
+        if (s == running) {
+          k.state.wait(running, std::memory_order_acquire);
+          s = k.state.load(std::memory_order_acquire);
+        }
+      }
+      return *k.value;
+    }
+
+    friend const T&
+    force(const Lazy& x){
+      return x.force();
     }
 
     bool
     isLazy() const {
-      return holds_alternative<thunk_type>(*ptr);
+      return ptr->state.load(std::memory_order_acquire) != ready;
     }
 
     friend bool
@@ -57,21 +144,12 @@ namespace ListProcessing::Dynamic::Details {
       return x.isReified();
     }
 
-
-  private:
-
-    const T&
-    reify(){
-      ptr = variant_type{get<thunk_type>(*ptr)()};
-      return get<value_type>(*ptr);
-    }
-
   };
 
   template<thunk F>
   auto
   lazy(F&& f){
     using T = std::remove_cvref_t<std::invoke_result_t<F>>;
-    return Lazy<T>{f};
+    return Lazy<T>{std::forward<F>(f)};
   }
 }
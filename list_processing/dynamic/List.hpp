@@ -48,6 +48,23 @@ namespace ListProcessing::Dynamic::Details {
     }
   } constexpr list{};
 
+  /**
+   * @brief Return a list of the input constant values
+   *
+   * @details The nodes of the list are built once, on the first call, in
+   * static storage that is never freed, as `List<T, 1>::StaticNodes`
+   * describes, so later calls neither allocate nor count references.
+   */
+  template<auto X, auto... Xs>
+  ListType<common_type_t<decltype(X), decltype(Xs)...>>
+  literal()
+  {
+    using T = common_type_t<decltype(X), decltype(Xs)...>;
+    using Nodes = typename ListType<T>::template StaticNodes<1 + sizeof...(Xs)>;
+    static Nodes nodes(array<T, 1 + sizeof...(Xs)>{T(X), T(Xs)...});
+    return nodes.list();
+  }
+
   /**
    * @brief Build a list of the results of applying the  input function
    * to each value in the half open range [0, n).
@@ -20,11 +20,14 @@ namespace ListProcessing::Dynamic::Details {
 
     friend ListOperators<List, T>;
 
-    List()
+    template<typename U>
+    friend struct Serializer;
+
+    constexpr List()
       : ptr(nullptr)
     {}
 
-    List(Nil)
+    constexpr List(Nil)
       : ptr(nullptr)
     {}
 
@@ -52,6 +55,61 @@ namespace ListProcessing::Dynamic::Details {
     using kernel_pointer = shared_ptr<const Kernel>;
     kernel_pointer ptr;
 
+    explicit List(kernel_pointer input_ptr)
+      : ptr(input_ptr)
+    {}
+
+  public:
+    /**
+     * @brief Storage for the nodes of a list that are never freed
+     *
+     * @details The nodes are built in place from an array of values, and
+     * the lists referring to them do not own them: copying such a list
+     * leaves no reference count to update, and nothing is released when
+     * the last copy is destroyed.  An instance is intended to have static
+     * storage duration, and it must outlive every list referring to it.
+     */
+    template<size_type N>
+    class StaticNodes
+    {
+    public:
+      explicit StaticNodes(array<value_type, N> const& values)
+        : StaticNodes(values, make_index_sequence<N>())
+      {}
+
+      StaticNodes(StaticNodes const&) = delete;
+
+      StaticNodes&
+      operator=(StaticNodes const&) = delete;
+
+      /**
+       * @brief Return the list of the values, in their original order
+       */
+      List
+      list() const
+      {
+        return link(0);
+      }
+
+    private:
+      template<size_t... Is>
+      StaticNodes(array<value_type, N> const& values, index_sequence<Is...>)
+        : nodes{Kernel(values[Is], link(Is + 1))...}
+      {}
+
+      List
+      link(size_type i) const
+      {
+        // An alias of an empty shared pointer has no control block.
+        return i < N ? List(kernel_pointer(kernel_pointer(), &nodes[i]))
+                     : List();
+      }
+
+      array<Kernel, N> nodes;
+    };
+
+  private:
+
     /**
      * @brief Return a list equivalent to the input with the
      * input value at the front.
@@ -62,6 +120,12 @@ namespace ListProcessing::Dynamic::Details {
       return List(x, xs);
     }
 
+    friend List
+    listCons(const_reference x, List xs)
+    {
+      return List(x, xs);
+    }
+
   public:
     bool
     hasData() const
@@ -146,16 +210,11 @@ namespace ListProcessing::Dynamic::Details {
 
     size_type
     length() const {
-      using tramp = Trampoline<size_type>;
-      struct Aux{
-        tramp
-        run(List xs, size_type accum) const {
-          return xs.hasData()
-            ? tramp([=,this]{ return run(xs.tail(), accum+1); })
-            : tramp(accum);
-        }
-      } constexpr aux{};
-      return size_type(aux.run(*this, 0));
+      size_type n = 0;
+      for (Kernel const* p = ptr.get(); p; p = p->tail.ptr.get()) {
+        ++n;
+      }
+      return n;
     }
 
     /**
@@ -202,19 +261,10 @@ namespace ListProcessing::Dynamic::Details {
     friend List
     rappend(List xs, List ys)
     {
-      using tramp = Trampoline<List>;
-      struct Aux
-      {
-        tramp
-        run(List xs, List ys) const
-        {
-          return xs.hasData() ? tramp([=, this] {
-            return run(xs.tail(), cons(xs.head(), ys));
-          })
-                              : tramp(ys);
-        }
-      } constexpr aux{};
-      return List(aux.run(xs, ys));
+      for (Kernel const* p = xs.ptr.get(); p; p = p->tail.ptr.get()) {
+        ys = cons(p->head, ys);
+      }
+      return ys;
     }
 
     /**
@@ -245,19 +295,10 @@ namespace ListProcessing::Dynamic::Details {
     friend U
     foldL(F f, U init, List xs)
     {
-      using tramp = Trampoline<U>;
-      struct Aux
-      {
-        tramp
-        run(F f, U init, List xs) const
-        {
-          return xs.hasData() ? Trampoline<U>([=, this] {
-            return run(f, f(init, xs.head()), xs.tail());
-          })
-                              : Trampoline<U>(init);
-        }
-      } constexpr aux{};
-      return U(aux.run(f, init, xs));
+      for (Kernel const* p = xs.ptr.get(); p; p = p->tail.ptr.get()) {
+        init = f(init, p->head);
+      }
+      return init;
     }
 
     /**
@@ -270,19 +311,10 @@ namespace ListProcessing::Dynamic::Details {
     friend U
     foldR(F f, List xs, U init)
     {
-      using tramp = Trampoline<U>;
-      struct Aux
-      {
-        tramp
-        run(F f, List xs, U init) const
-        {
-          return xs.hasData() ? tramp([=, this] {
-            return run(f, xs.tail(), f(xs.head(), init));
-          })
-                              : tramp(init);
-        }
-      } constexpr aux{};
-      return U(aux.run(f, xs, init));
+      for (Kernel const* p = xs.ptr.get(); p; p = p->tail.ptr.get()) {
+        init = f(p->head, init);
+      }
+      return init;
     }
 
     /**
@@ -295,19 +327,10 @@ namespace ListProcessing::Dynamic::Details {
     static Result
     rMap(F f, List xs, Result accum)
     {
-      using tramp = Trampoline<Result>;
-      struct Aux
-      {
-        tramp
-        run(F f, List xs, Result accum) const
-        {
-          return xs.hasData() ? tramp([=, this] {
-            return run(f, xs.tail(), cons(f(xs.head()), accum));
-          })
-                              : tramp(accum);
-        }
-      } constexpr aux{};
-      return Result(aux.run(f, xs, accum));
+      for (Kernel const* p = xs.ptr.get(); p; p = p->tail.ptr.get()) {
+        accum = cons(f(p->head), accum);
+      }
+      return accum;
     }
 
     /**
@@ -327,14 +350,11 @@ namespace ListProcessing::Dynamic::Details {
     }
 
     template<typename F, typename Result>
-    static Trampoline<Result>
+    static Result
     aMapAux(F fs, List xs, Result accum)
     {
-      using tramp = Trampoline<Result>;
-      return fs.hasData() ? tramp([=] {
-        return aMapAux(fs.tail(), xs, rappend(map(fs.head(), xs), accum));
-      })
-                          : tramp(reverse(accum));
+      doList(fs, [&](auto const& f) { accum = rappend(map(f, xs), accum); });
+      return reverse(accum);
     }
 
     /**
@@ -371,19 +391,11 @@ namespace ListProcessing::Dynamic::Details {
     friend Result
     mMap(F f, List xs)
     {
-      using tramp = Trampoline<Result>;
-      struct Aux
-      {
-        tramp
-        run(F f, List xs, Result accum) const
-        {
-          return xs.hasData() ? tramp([=, this] {
-            return run(f, xs.tail(), rappend(f(xs.head()), accum));
-          })
-                              : tramp(accum.reverse());
-        }
-      } constexpr aux{};
-      return Result(aux.run(f, xs, Result::nil));
+      Result accum = Result::nil;
+      for (Kernel const* p = xs.ptr.get(); p; p = p->tail.ptr.get()) {
+        accum = rappend(f(p->head), accum);
+      }
+      return accum.reverse();
     }
 
     /**
@@ -395,19 +407,10 @@ namespace ListProcessing::Dynamic::Details {
     friend List
     buildListAux(F f, size_type n, List accum)
     {
-      using tramp = Trampoline<List>;
-      struct Aux
-      {
-        tramp
-        run(F f, size_type n, List accum) const
-        {
-          return n > 0 ? tramp([=, this] {
-            return run(f, n - 1, cons(f(n - 1), accum));
-          })
-                       : tramp(accum);
-        }
-      } constexpr aux{};
-      return List(aux.run(f, n, accum));
+      for (; n > 0; --n) {
+        accum = cons(f(n - 1), accum);
+      }
+      return accum;
     }
 
     /**
@@ -420,18 +423,11 @@ namespace ListProcessing::Dynamic::Details {
     friend List
     drop(List xs, size_type n)
     {
-      using tramp = Trampoline<List>;
-      struct Aux
-      {
-        tramp
-        run(List xs, size_type n) const
-        {
-          return xs.hasData() && n > 0
-                   ? tramp([=, this] { return run(xs.tail(), n - 1); })
-                   : tramp(xs);
-        }
-      } constexpr aux{};
-      return List(aux.run(xs, n));
+      List const* p = &xs;
+      for (; p->hasData() && n > 0; --n) {
+        p = &p->ptr->tail;
+      }
+      return *p;
     }
 
     /**
@@ -445,19 +441,12 @@ namespace ListProcessing::Dynamic::Details {
     friend List
     take(List xs, size_type n)
     {
-      using tramp = Trampoline<List>;
-      struct Aux
-      {
-        tramp
-        run(List xs, size_type n, List accum)
-        {
-          return xs.hasData() && n > 0 ? tramp([=, this] {
-            return run(xs.tail(), n - 1, cons(xs.head(), accum));
-          })
-                                       : tramp(accum.reverse());
-        }
-      } constexpr aux{};
-      return List(aux.run(xs, n, nil));
+      List accum = nil;
+      for (Kernel const* p = xs.ptr.get(); p && n > 0;
+           p = p->tail.ptr.get(), --n) {
+        accum = cons(p->head, accum);
+      }
+      return accum.reverse();
     }
 
     /**
@@ -482,20 +471,14 @@ namespace ListProcessing::Dynamic::Details {
     friend bool
     operator==(List xs, List ys)
     {
-      using tramp = Trampoline<bool>;
-      struct Aux
-      {
-        tramp
-        run(List xs, List ys) const
-        {
-          return xs.hasData() && ys.hasData()
-                   ? (xs.head() == ys.head()
-                        ? tramp([=, this] { return run(xs.tail(), ys.tail()); })
-                        : tramp(false))
-                   : tramp(xs.isNull() && ys.isNull() ? true : false);
+      Kernel const* p = xs.ptr.get();
+      Kernel const* q = ys.ptr.get();
+      for (; p && q; p = p->tail.ptr.get(), q = q->tail.ptr.get()) {
+        if (!(p->head == q->head)) {
+          return false;
         }
-      } constexpr aux{};
-      return bool(aux.run(xs, ys));
+      }
+      return p == q;
     }
 
     /**
@@ -516,18 +499,101 @@ namespace ListProcessing::Dynamic::Details {
      */
     template<typename F>
     friend F
-    doList(List xs, F f)
+    doList(List const& xs, F f)
     {
-      unique_ptr<List> ptr(make_unique<List>(xs));
-      while (!ptr->isNull()) {
-        f(ptr->head());
-        ptr = make_unique<List>(ptr->tail());
+      // The nodes are kept alive by `xs`, so the walk does not need
+      // to touch their reference counts.
+      for (Kernel const* p = xs.ptr.get(); p; p = p->tail.ptr.get()) {
+        f(p->head);
       }
       return f;
     }
 
+    /**
+     * @brief Return a pointer to the first element of the input list
+     * satisfying the input predicate, or a null pointer if there is none.
+     *
+     * @details The pointer remains valid for as long as the input list.
+     */
+    template<typename P>
+    friend value_type const*
+    findFirst(List const& xs, P pred)
+    {
+      for (Kernel const* p = xs.ptr.get(); p; p = p->tail.ptr.get()) {
+        if (pred(p->head)) {
+          return &p->head;
+        }
+      }
+      return nullptr;
+    }
+
   public:
-    inline static const List nil{};
+    /**
+     * @brief Return a list with the elements of this list stably sorted
+     * by the input comparison.
+     */
+    template<typename Cmp>
+    List
+    sort(Cmp cmp) const
+    {
+      return sortList(cmp, *this);
+    }
+
+    /**
+     * @brief Return an association list from each key returned by the
+     * input function to the elements with that key.
+     */
+    template<typename F>
+    auto
+    groupBy(F key) const
+    {
+      return hashGroupBy(key, *this);
+    }
+
+    /**
+     * @brief Return an association list from each key returned by the
+     * input function to the number of elements with that key.
+     */
+    template<typename F>
+    auto
+    countBy(F key) const
+    {
+      return hashCountBy(key, *this);
+    }
+
+    /**
+     * @brief Return the first occurrences of the elements, in order.
+     */
+    auto
+    distinct() const
+    {
+      return hashDistinct(*this);
+    }
+
+    /**
+     * @brief Return the pairs of elements of this list and the input
+     * collection that have equal keys.
+     */
+    template<typename F, typename Ys>
+    auto
+    innerJoin(F key, Ys const& ys) const
+    {
+      return hashInnerJoin(key, *this, ys);
+    }
+
+    /**
+     * @brief Return the pairs of elements of this list and the input
+     * collection that have equal keys, keeping unmatched elements of this
+     * list.
+     */
+    template<typename F, typename Ys>
+    auto
+    leftJoin(F key, Ys const& ys) const
+    {
+      return hashLeftJoin(key, *this, ys);
+    }
+
+    inline static constinit const List nil{};
 
   }; // end of class List<T,1>
 
@@ -4,6 +4,7 @@
 // ... List Processing header files
 //
 #include <list_processing/dynamic/ListTraits.hpp>
+#include <list_processing/dynamic/SerializerFwd.hpp>
 
 namespace ListProcessing::Dynamic::Details {
 
@@ -24,8 +25,7 @@ namespace ListProcessing::Dynamic::Details {
   class List;
 
   template<typename T>
-  const List<T, ListTraits<T>::chunk_size> nil =
-    List<T, ListTraits<T>::chunk_size>::nil;
+  constinit const List<T, ListTraits<T>::chunk_size> nil{};
 
   template<typename T>
   using ListType = List<T, ListTraits<T>::chunk_size>;
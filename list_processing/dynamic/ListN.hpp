@@ -28,12 +28,15 @@ namespace ListProcessing::Dynamic::Details {
   private:
     Data data;
 
+    template<typename U>
+    friend struct Serializer;
+
   public:
-    List()
-      : data(Data::nil) {}
+    constexpr List()
+      : data() {}
 
-    List(Nil)
-      : data(Data::nil) {}
+    constexpr List(Nil)
+      : data() {}
 
     List(const_reference x, List const& xs)
       : data(
@@ -44,7 +47,40 @@ namespace ListProcessing::Dynamic::Details {
     List(Data input_data)
       : data(input_data) {}
 
-    inline static const List nil = List();
+    inline static constinit const List nil{};
+
+    /**
+     * @brief Storage for the chunks and nodes of a list that are never
+     * freed
+     *
+     * @details See `List<T, 1>::StaticNodes`.
+     */
+    template<size_type Count>
+    class StaticNodes
+    {
+      using Chunks = typename Datum::template StaticChunks<Count>;
+
+    public:
+      explicit StaticNodes(array<value_type, Count> const& values)
+        : chunks(values)
+        , nodes(chunks.chunks())
+      {}
+
+      StaticNodes(StaticNodes const&) = delete;
+
+      StaticNodes&
+      operator=(StaticNodes const&) = delete;
+
+      List
+      list() const
+      {
+        return List(nodes.list());
+      }
+
+    private:
+      Chunks chunks;
+      typename Data::template StaticNodes<Chunks::size> nodes;
+    };
 
     bool
     hasData() const {
@@ -137,48 +173,71 @@ namespace ListProcessing::Dynamic::Details {
                    : Trampoline<List>(xs);
     }
 
+    /**
+     * @brief Return a list of the results of applying the input function
+     * to each index in the half open range [0, n), followed by the
+     * elements of the input list.
+     *
+     * @details The new elements are written directly into chunks, so
+     * the cost is one allocation per chunk rather than per element.
+     */
     template<typename F>
     friend List
     buildListAux(F f, size_type n, List xs) {
-      struct Aux {
-        Trampoline<List>
-        run(F f, size_type n, List xs) const {
-          return n > 0 ? Trampoline<List>([=, this] {
-            return run(f, n - 1, cons(f(n - 1), xs));
-          })
-                       : Trampoline<List>(xs);
-        }
-      } constexpr aux{};
-      return List(aux.run(f, n, xs));
+      if (n <= 0) {
+        return xs;
+      }
+
+      // The head chunk takes the remainder, so the others are full.
+      size_type head_size = n % N == 0 ? N : n % N;
+      Data data = xs.data;
+      for (index_type c = (n - head_size) / N; c >= 0; --c) {
+        index_type start = c == 0 ? 0 : head_size + (c - 1) * N;
+        size_type length = c == 0 ? head_size : N;
+        data = cons(
+          buildShortList<T, N>(
+            [&](index_type i) -> value_type { return f(start + i); }, length),
+          data);
+      }
+      return List(data);
     }
 
+    /**
+     * @brief Return the input list without its first n elements
+     *
+     * @details Whole chunks are skipped and the remaining chunks are
+     * shared with the input list.
+     */
     friend List
     drop(List xs, size_type n) {
-      using tramp = Trampoline<List>;
-      struct Aux {
-        tramp
-        run(List xs, size_type n) const {
-          return xs.hasData() && n > 0
-                   ? tramp([=, this] { return run(xs.tail(), n - 1); })
-                   : tramp(xs);
-        }
-      } constexpr aux{};
-      return List(aux.run(xs, n));
+      Data data = xs.data;
+      while (n > 0 && data.hasData() && data.head().length() <= n) {
+        n -= data.head().length();
+        data = data.tail();
+      }
+      return n > 0 && data.hasData()
+               ? List(cons(data.head().drop(n), data.tail()))
+               : List(data);
     }
 
+    /**
+     * @brief Return a list of the first n elements of the input list
+     *
+     * @details Chunks that are taken whole are shared with the input list.
+     */
     friend List
     take(List xs, size_type n) {
-      using tramp = Trampoline<List>;
-      struct Aux {
-        tramp
-        run(List xs, size_type n, List accum) const {
-          return xs.hasData() && n > 0 ? tramp([=, this] {
-            return run(xs.tail(), n - 1, cons(xs.head(), accum));
-          })
-                                       : tramp(reverse(accum));
-        }
-      } constexpr aux{};
-      return List(aux.run(xs, n, nil));
+      vector<Datum> chunks{};
+      for (Data data = xs.data; n > 0 && data.hasData(); data = data.tail()) {
+        Datum const& chunk = data.head();
+        chunks.push_back(n < chunk.length() ? chunk.take(n) : chunk);
+        n -= std::min(n, chunk.length());
+      }
+      Data data = Data::nil;
+      for (auto chunk = chunks.rbegin(); chunk != chunks.rend(); ++chunk) {
+        data = cons(*chunk, data);
+      }
+      return List(data);
     }
 
     friend value_type
@@ -245,9 +304,22 @@ namespace ListProcessing::Dynamic::Details {
       return rappend(xs, nil);
     }
 
+    /**
+     * @brief Return a list of the elements of the first input list
+     * followed by those of the second
+     *
+     * @details The chunks of both lists are shared with the result, so
+     * only the links to the chunks of the first list are rebuilt.
+     */
     friend List
     append(List xs, List ys) {
-      return rappend(reverse(xs), ys);
+      vector<Datum const*> chunks{};
+      doChunks(xs, [&](Datum const& chunk) { chunks.push_back(&chunk); });
+      Data data = ys.data;
+      for (auto chunk = chunks.rbegin(); chunk != chunks.rend(); ++chunk) {
+        data = cons(**chunk, data);
+      }
+      return List(data);
     }
 
     template<typename F, typename U>
@@ -353,16 +425,107 @@ namespace ListProcessing::Dynamic::Details {
       return Result(aux.run(f, xs, Result::nil));
     }
 
+    /**
+     * @brief Return a list with the elements of this list stably sorted
+     * by the input comparison.
+     */
+    template<typename Cmp>
+    List
+    sort(Cmp cmp) const {
+      return sortList(cmp, *this);
+    }
+
+    /**
+     * @brief Return an association list from each key returned by the
+     * input function to the elements with that key.
+     */
+    template<typename F>
+    auto
+    groupBy(F key) const {
+      return hashGroupBy(key, *this);
+    }
+
+    /**
+     * @brief Return an association list from each key returned by the
+     * input function to the number of elements with that key.
+     */
+    template<typename F>
+    auto
+    countBy(F key) const {
+      return hashCountBy(key, *this);
+    }
+
+    /**
+     * @brief Return the first occurrences of the elements, in order.
+     */
+    auto
+    distinct() const {
+      return hashDistinct(*this);
+    }
+
+    /**
+     * @brief Return the pairs of elements of this list and the input
+     * collection that have equal keys.
+     */
+    template<typename F, typename Ys>
+    auto
+    innerJoin(F key, Ys const& ys) const {
+      return hashInnerJoin(key, *this, ys);
+    }
+
+    /**
+     * @brief Return the pairs of elements of this list and the input
+     * collection that have equal keys, keeping unmatched elements of this
+     * list.
+     */
+    template<typename F, typename Ys>
+    auto
+    leftJoin(F key, Ys const& ys) const {
+      return hashLeftJoin(key, *this, ys);
+    }
+
+    /**
+     * @brief Call a function with each chunk of an input list
+     *
+     * @details The chunks are passed by reference and remain valid for
+     * as long as the input list.
+     */
     template<typename F>
     friend F
-    doList(List xs, F f) {
-      unique_ptr<List> ptr(make_unique<List>(xs));
-      while (!ptr->isNull()) {
-        f(ptr->head());
-        ptr = make_unique<List>(ptr->tail());
-      }
+    doChunks(List const& xs, F f) {
+      doList(xs.data, [&](Datum const& chunk) { f(chunk); });
       return f;
     }
+
+    template<typename F>
+    friend F
+    doList(List const& xs, F f) {
+      doList(xs.data, [&](Datum const& chunk) {
+        for (size_type i = 0, n = chunk.length(); i < n; ++i) {
+          f(chunk.listRef(i));
+        }
+      });
+      return f;
+    }
+
+    /**
+     * @brief Return a pointer to the first element of the input list
+     * satisfying the input predicate, or a null pointer if there is none.
+     */
+    template<typename P>
+    friend value_type const*
+    findFirst(List const& xs, P pred) {
+      value_type const* found = nullptr;
+      findFirst(xs.data, [&](Datum const& chunk) {
+        for (size_type i = 0, n = chunk.length(); i < n && !found; ++i) {
+          if (pred(chunk.listRef(i))) {
+            found = &chunk.listRef(i);
+          }
+        }
+        return found != nullptr;
+      });
+      return found;
+    }
   }; // end of class List<T,N>
 
 } // end of namespace ListProcessing::Dynamic::Details
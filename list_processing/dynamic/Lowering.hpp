@@ -0,0 +1,91 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/compile_time.hpp>
+#include <list_processing/dynamic/AList.hpp>
+#include <list_processing/dynamic/List.hpp>
+#include <list_processing/dynamic/import.hpp>
+
+namespace ListProcessing::Dynamic::Details {
+
+  /**
+   * @brief Return the elements of a compile-time list or container as a
+   * compile-time list.
+   */
+  template<typename C>
+  constexpr auto
+  compileTimeList(C const& xs)
+  {
+    if constexpr (requires { xs.toList(); }) {
+      return xs.toList();
+    } else {
+      return xs;
+    }
+  }
+
+  template<auto const& Xs>
+  using CompileTimeFlatListOf =
+    decltype(CompileTime::Details::toFlatList(compileTimeList(Xs)));
+
+  template<typename L>
+  struct LoweredValue;
+
+  template<typename... Ts>
+  struct LoweredValue<CompileTime::Details::FlatList<Ts...>>
+  {
+    using type = common_type_t<Ts...>;
+  };
+
+  template<typename L>
+  struct LoweredAssoc;
+
+  template<typename... Ts>
+  struct LoweredAssoc<CompileTime::Details::FlatList<Ts...>>
+  {
+    using key_type = common_type_t<typename Ts::first_type...>;
+    using mapped_type = common_type_t<typename Ts::second_type...>;
+  };
+
+  /**
+   * @brief Return a dynamic list with the elements of a compile-time
+   * list, stack or queue.
+   *
+   * @details The compile-time container is named by reference, and it must
+   * have static storage duration.  Its elements are converted to `T`,
+   * which defaults to their common type, and stored once, on the first
+   * call, in nodes that are never freed.  Every call returns a list
+   * sharing those nodes, so after the first call no memory is allocated,
+   * and copies of the list never update a reference count.
+   */
+  template<
+    auto const& Xs,
+    typename T = typename LoweredValue<CompileTimeFlatListOf<Xs>>::type>
+  ListType<T>
+  lowerList()
+  {
+    using Nodes = typename ListType<T>::template StaticNodes<
+      CompileTime::Details::length_(TypeUtility::type<
+                                    decay_t<decltype(compileTimeList(Xs))>>)>;
+    static Nodes nodes(applyList(
+      [](auto const&... xs) { return array<T, sizeof...(xs)>{T(xs)...}; },
+      compileTimeList(Xs)));
+    return nodes.list();
+  }
+
+  /**
+   * @brief Return a dynamic alist with the associations of a compile-time
+   * alist, in nodes that are never freed, as `lowerList` does.
+   */
+  template<
+    auto const& Xs,
+    typename K = typename LoweredAssoc<CompileTimeFlatListOf<Xs>>::key_type,
+    typename V = typename LoweredAssoc<CompileTimeFlatListOf<Xs>>::mapped_type>
+  AList<K, V>
+  lowerAList()
+  {
+    return AList<K, V>(lowerList<Xs, pair<K, V>>());
+  }
+
+} // end of namespace ListProcessing::Dynamic::Details
@@ -0,0 +1,366 @@
+#pragma once
+
+//
+// ... Standard header files
+//
+#include <list>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/Lazy.hpp>
+#include <list_processing/dynamic/import.hpp>
+
+namespace ListProcessing::Dynamic::Details {
+
+  /**
+   * @brief The rule by which a full memoization cache chooses what to drop
+   *
+   * @details
+   *  - `lru` drops the entry used least recently.
+   *  - `clock` approximates `lru` with a reference bit per entry and a
+   *    hand sweeping over them, so that a hit only sets a bit.
+   *  - `tinyLfu` keeps the entries in `lru` order, but admits a new entry
+   *    only when its key has been asked for more often than the key of
+   *    the entry it would replace, as estimated by a small frequency
+   *    sketch, so that a burst of keys asked for once does not flush
+   *    the keys asked for often.
+   */
+  enum class EvictionPolicy { lru, clock, tinyLfu };
+
+  /**
+   * @brief Counts of the lookups in a memoization cache
+   */
+  struct MemoStatistics
+  {
+    size_type hits;
+    size_type misses;
+    size_type evictions;
+
+    double
+    hitRate() const
+    {
+      return hits + misses == 0 ? 0.0 : double(hits) / double(hits + misses);
+    }
+  };
+
+  /**
+   * @brief An estimate of how often each key has been seen
+   *
+   * @details A count-min sketch of four rows of counters that saturate
+   * at 15.  Every counter is halved once as many keys have been recorded
+   * as ten times the capacity, so that the estimates favour recent use.
+   * Small capacities are rounded up, so that a small cache does not
+   * forget a frequent key after a short burst of others.
+   */
+  class FrequencySketch
+  {
+  public:
+    explicit FrequencySketch(size_type capacity)
+      : counters(std::bit_ceil(size_t(std::max(min_capacity, capacity))))
+      , period(10 * size_type(counters.size()))
+    {}
+
+    void
+    record(std::uint64_t h)
+    {
+      for (int row = 0; row < rows; ++row) {
+        auto& counter = counters[indexOf(h, row)][row];
+        if (counter < 15) {
+          ++counter;
+        }
+      }
+      if (++recorded == period) {
+        age();
+      }
+    }
+
+    unsigned
+    estimate(std::uint64_t h) const
+    {
+      unsigned result = 15;
+      for (int row = 0; row < rows; ++row) {
+        result = std::min(result, unsigned(counters[indexOf(h, row)][row]));
+      }
+      return result;
+    }
+
+  private:
+    static constexpr int rows = 4;
+    static constexpr size_type min_capacity = 64;
+
+    size_t
+    indexOf(std::uint64_t h, int row) const
+    {
+      static constexpr std::uint64_t seeds[rows] = {
+        0x9e3779b97f4a7c15, 0xc2b2ae3d27d4eb4f,
+        0x165667b19e3779f9, 0xd6e8feb86659fd93};
+      return size_t((h * seeds[row]) >> 32) & (counters.size() - 1);
+    }
+
+    void
+    age()
+    {
+      for (auto& column : counters) {
+        for (auto& counter : column) {
+          counter /= 2;
+        }
+      }
+      recorded /= 2;
+    }
+
+    vector<array<std::uint8_t, rows>> counters;
+    size_type period;
+    size_type recorded{0};
+  };
+
+  /**
+   * @brief A function memoized in a cache of bounded size
+   *
+   * @details Calling the memoized function returns the cached result for
+   * its key, or computes it.  A result is cached as a `Lazy` value before
+   * it is computed, so that concurrent calls with the same key share one
+   * computation rather than each running the function.  The cache is
+   * split into shards by the hash of the key, each guarded by its own
+   * lock, which is held only to find or insert the lazy value, never
+   * while the function runs.  Each shard holds its share of the capacity
+   * and evicts by the chosen policy.  Copies share the cache.
+   */
+  template<typename K, typename F, typename Hash = std::hash<K>>
+  class Memoized
+  {
+  public:
+    using key_type = K;
+    using value_type = remove_cvref_t<invoke_result_t<F const&, K const&>>;
+    using lazy_type = Lazy<value_type>;
+
+    Memoized(F f, size_type capacity, EvictionPolicy policy)
+      : state(make_shared<State>(std::move(f), capacity, policy))
+    {}
+
+    /**
+     * @brief Return the result for the input key, computing it if needed
+     */
+    value_type
+    operator()(K const& key) const
+    {
+      return force(lookup(key));
+    }
+
+    /**
+     * @brief Return the lazy result for the input key, without forcing it
+     */
+    lazy_type
+    lookup(K const& key) const
+    {
+      std::uint64_t h = std::uint64_t(Hash{}(key));
+      Shard& shard = state->shardOf(h);
+      lock_guard lock{shard.mex};
+      if (shard.policy == EvictionPolicy::tinyLfu) {
+        shard.sketch.record(h);
+      }
+      if (auto found = shard.find(key)) {
+        ++state->hits;
+        return *found;
+      }
+      ++state->misses;
+      lazy_type result([f = state->f, key] { return (*f)(key); });
+      state->evictions += shard.insert(key, h, result);
+      return result;
+    }
+
+    MemoStatistics
+    statistics() const
+    {
+      return MemoStatistics{
+        state->hits.load(), state->misses.load(), state->evictions.load()};
+    }
+
+    friend MemoStatistics
+    statistics(Memoized const& xs)
+    {
+      return xs.statistics();
+    }
+
+    /**
+     * @brief Return the number of results in the cache
+     */
+    size_type
+    size() const
+    {
+      size_type result = 0;
+      for (Shard& shard : state->shards) {
+        lock_guard lock{shard.mex};
+        result += size_type(shard.entries.size());
+      }
+      return result;
+    }
+
+    friend size_type
+    size(Memoized const& xs)
+    {
+      return xs.size();
+    }
+
+    /**
+     * @brief Drop every result from the cache
+     */
+    void
+    clear() const
+    {
+      for (Shard& shard : state->shards) {
+        lock_guard lock{shard.mex};
+        shard.clear();
+      }
+    }
+
+  private:
+    struct Entry;
+    using map_type = unordered_map<K, Entry, Hash>;
+    using node_type = typename map_type::value_type;
+
+    struct Entry
+    {
+      lazy_type value;
+      typename std::list<K>::iterator position{};
+      bool referenced{false};
+    };
+
+    struct Shard
+    {
+      Shard(size_type capacity, EvictionPolicy policy)
+        : capacity(capacity)
+        , policy(policy)
+        , sketch(policy == EvictionPolicy::tinyLfu ? capacity : 0)
+      {}
+
+      optional<lazy_type>
+      find(K const& key)
+      {
+        auto found = entries.find(key);
+        if (found == entries.end()) {
+          return nullopt;
+        }
+        Entry& entry = found->second;
+        if (policy == EvictionPolicy::clock) {
+          entry.referenced = true;
+        } else {
+          order.splice(order.begin(), order, entry.position);
+        }
+        return entry.value;
+      }
+
+      // Insert the input result and return the number of entries evicted
+      // to make room for it.
+      size_type
+      insert(K const& key, std::uint64_t h, lazy_type const& value)
+      {
+        if (policy == EvictionPolicy::clock) {
+          return insertClock(key, value);
+        }
+        size_type evicted = 0;
+        if (size_type(entries.size()) == capacity) {
+          if (
+            policy == EvictionPolicy::tinyLfu &&
+            sketch.estimate(h) <= sketch.estimate(Hash{}(order.back()))) {
+            return 0;
+          }
+          entries.erase(order.back());
+          order.pop_back();
+          evicted = 1;
+        }
+        order.push_front(key);
+        entries.emplace(key, Entry{value, order.begin()});
+        return evicted;
+      }
+
+      size_type
+      insertClock(K const& key, lazy_type const& value)
+      {
+        if (size_type(ring.size()) < capacity) {
+          ring.push_back(&*entries.emplace(key, Entry{value}).first);
+          return 0;
+        }
+        while (ring[hand]->second.referenced) {
+          ring[hand]->second.referenced = false;
+          hand = (hand + 1) % ring.size();
+        }
+        entries.erase(ring[hand]->first);
+        ring[hand] = &*entries.emplace(key, Entry{value}).first;
+        hand = (hand + 1) % ring.size();
+        return 1;
+      }
+
+      void
+      clear()
+      {
+        entries.clear();
+        order.clear();
+        ring.clear();
+        hand = 0;
+      }
+
+      mutex mex{};
+      size_type capacity;
+      EvictionPolicy policy;
+      map_type entries{};
+      std::list<K> order{};
+      vector<node_type*> ring{};
+      size_t hand{0};
+      FrequencySketch sketch;
+    };
+
+    struct State
+    {
+      State(F f, size_type capacity, EvictionPolicy policy)
+        : f(make_shared<F const>(std::move(f)))
+      {
+        if (capacity < 1) {
+          throw logic_error("Memoization capacity must be positive");
+        }
+        size_type count = capacity < max_shards * min_shard_capacity
+                            ? size_type(1)
+                            : max_shards;
+        for (size_type i = 0; i < count; ++i) {
+          shards.emplace_back(
+            capacity / count + (i < capacity % count ? 1 : 0), policy);
+        }
+      }
+
+      Shard&
+      shardOf(std::uint64_t h)
+      {
+        // The hash is mixed before its top bits choose the shard, since
+        // a hash such as that of an integer may be the identity, and the
+        // low bits choose the bucket within a shard.
+        std::uint64_t mixed = h * 0x9e3779b97f4a7c15;
+        return shards[size_t((mixed >> 56) % shards.size())];
+      }
+
+      static constexpr size_type max_shards = 16;
+      static constexpr size_type min_shard_capacity = 16;
+
+      shared_ptr<F const> f;
+      std::deque<Shard> shards{};
+      atomic<size_type> hits{0};
+      atomic<size_type> misses{0};
+      atomic<size_type> evictions{0};
+    };
+
+    shared_ptr<State> state;
+  };
+
+  /**
+   * @brief Return the input function memoized in a cache holding at most
+   * `capacity` results
+   */
+  template<typename K, typename Hash = std::hash<K>, typename F>
+  Memoized<K, remove_cvref_t<F>, Hash>
+  memoize(
+    F&& f, size_type capacity, EvictionPolicy policy = EvictionPolicy::lru)
+  {
+    return Memoized<K, remove_cvref_t<F>, Hash>(
+      std::forward<F>(f), capacity, policy);
+  }
+
+} // end of namespace ListProcessing::Dynamic::Details
@@ -0,0 +1,683 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/AList.hpp>
+#include <list_processing/dynamic/List.hpp>
+#include <list_processing/dynamic/import.hpp>
+
+namespace ListProcessing::Dynamic::Details {
+
+  /**
+   * @brief A persistent map with keys in order
+   *
+   * @details The associations are held in a weight balanced binary search
+   * tree, so lookup, insertion and removal take O(log n) time, and an
+   * update copies only the path to the affected node, sharing the rest of
+   * the tree with the original map.  Splitting a map at a key and joining
+   * two maps with ordered keys also take O(log n) time, which makes range
+   * queries O(log n) plus the size of the range.
+   *
+   * @tparam K - a type parameter specifying the type of the keys
+   *
+   * @tparam T - a type parameter specifying the type of the values
+   *
+   * @tparam Cmp - a type parameter specifying the strict weak order of
+   * the keys
+   */
+  template<typename K, typename T, typename Cmp = std::less<K>>
+  class OrderedMap {
+  public:
+    using key_type = K;
+    using value_type = T;
+    using assoc_type = pair<K, T>;
+
+    OrderedMap() = default;
+
+  private:
+    struct Node;
+    using pointer = shared_ptr<const Node>;
+
+    struct Node {
+      assoc_type assoc;
+      size_type size;
+      pointer left;
+      pointer right;
+    };
+
+    pointer root{};
+
+    explicit OrderedMap(pointer input_root)
+      : root{input_root} {}
+
+    //
+    // ... Tree operations
+    //
+
+    // The balance parameters of Hirai and Yamamoto, which keep the
+    // weight of a subtree within a factor of `delta` of its sibling.
+    static constexpr size_type delta = 3;
+    static constexpr size_type gamma = 2;
+
+    static bool
+    less(K const& x, K const& y) {
+      return Cmp{}(x, y);
+    }
+
+    static size_type
+    sizeOf(pointer const& p) {
+      return p ? p->size : 0;
+    }
+
+    static pointer
+    makeNode(assoc_type const& assoc, pointer const& l, pointer const& r) {
+      return make_shared<const Node>(
+        Node{assoc, sizeOf(l) + sizeOf(r) + 1, l, r});
+    }
+
+    /**
+     * @brief Return true if a subtree with `a` nodes is heavy enough to
+     * be the sibling of a subtree with `b` nodes.
+     */
+    static bool
+    isBalanced(size_type a, size_type b) {
+      return delta * (a + 1) >= b + 1;
+    }
+
+    static bool
+    isSingle(size_type a, size_type b) {
+      return a + 1 < gamma * (b + 1);
+    }
+
+    /**
+     * @brief Return a node with the input association and children,
+     * rotating when one child became too heavy by a single update.
+     */
+    static pointer
+    balance(assoc_type const& assoc, pointer const& l, pointer const& r) {
+      if (!isBalanced(sizeOf(l), sizeOf(r))) {
+        return isSingle(sizeOf(r->left), sizeOf(r->right))
+                 ? makeNode(r->assoc, makeNode(assoc, l, r->left), r->right)
+                 : makeNode(
+                     r->left->assoc,
+                     makeNode(assoc, l, r->left->left),
+                     makeNode(r->assoc, r->left->right, r->right));
+      }
+      if (!isBalanced(sizeOf(r), sizeOf(l))) {
+        return isSingle(sizeOf(l->right), sizeOf(l->left))
+                 ? makeNode(l->assoc, l->left, makeNode(assoc, l->right, r))
+                 : makeNode(
+                     l->right->assoc,
+                     makeNode(l->assoc, l->left, l->right->left),
+                     makeNode(assoc, l->right->right, r));
+      }
+      return makeNode(assoc, l, r);
+    }
+
+    /**
+     * @brief Return a tree with the keys of `l`, the input association
+     * and the keys of `r`, which must be in that order.
+     */
+    static pointer
+    link(assoc_type const& assoc, pointer const& l, pointer const& r) {
+      if (!isBalanced(sizeOf(l), sizeOf(r))) {
+        return balance(r->assoc, link(assoc, l, r->left), r->right);
+      }
+      if (!isBalanced(sizeOf(r), sizeOf(l))) {
+        return balance(l->assoc, l->left, link(assoc, l->right, r));
+      }
+      return makeNode(assoc, l, r);
+    }
+
+    /**
+     * @brief Return the input tree without its least association, which
+     * is stored in the output argument.
+     */
+    static pointer
+    removeMin(pointer const& p, assoc_type const*& min) {
+      if (!p->left) {
+        min = &p->assoc;
+        return p->right;
+      }
+      return balance(p->assoc, removeMin(p->left, min), p->right);
+    }
+
+    /**
+     * @brief Return a tree with the keys of `l` followed by those of `r`.
+     */
+    static pointer
+    merge(pointer const& l, pointer const& r) {
+      if (!l) {
+        return r;
+      }
+      if (!r) {
+        return l;
+      }
+      if (!isBalanced(sizeOf(l), sizeOf(r))) {
+        return balance(r->assoc, merge(l, r->left), r->right);
+      }
+      if (!isBalanced(sizeOf(r), sizeOf(l))) {
+        return balance(l->assoc, l->left, merge(l->right, r));
+      }
+      assoc_type const* min = nullptr;
+      pointer rest = removeMin(r, min);
+      return balance(*min, l, rest);
+    }
+
+    static pointer
+    insertAux(pointer const& p, K const& key, T const& value) {
+      if (!p) {
+        return makeNode(assoc_type(key, value), {}, {});
+      }
+      if (less(key, p->assoc.first)) {
+        return balance(p->assoc, insertAux(p->left, key, value), p->right);
+      }
+      if (less(p->assoc.first, key)) {
+        return balance(p->assoc, p->left, insertAux(p->right, key, value));
+      }
+      return makeNode(assoc_type(key, value), p->left, p->right);
+    }
+
+    static pointer
+    eraseAux(pointer const& p, K const& key) {
+      if (!p) {
+        return p;
+      }
+      if (less(key, p->assoc.first)) {
+        pointer l = eraseAux(p->left, key);
+        return l == p->left ? p : balance(p->assoc, l, p->right);
+      }
+      if (less(p->assoc.first, key)) {
+        pointer r = eraseAux(p->right, key);
+        return r == p->right ? p : balance(p->assoc, p->left, r);
+      }
+      return merge(p->left, p->right);
+    }
+
+    static tuple<pointer, assoc_type const*, pointer>
+    splitAux(pointer const& p, K const& key) {
+      if (!p) {
+        return {pointer{}, nullptr, pointer{}};
+      }
+      if (less(key, p->assoc.first)) {
+        auto [l, found, r] = splitAux(p->left, key);
+        return {l, found, link(p->assoc, r, p->right)};
+      }
+      if (less(p->assoc.first, key)) {
+        auto [l, found, r] = splitAux(p->right, key);
+        return {link(p->assoc, p->left, l), found, r};
+      }
+      return {p->left, &p->assoc, p->right};
+    }
+
+    Node const*
+    find(K const& key) const {
+      Node const* p = root.get();
+      while (p) {
+        if (less(key, p->assoc.first)) {
+          p = p->left.get();
+        } else if (less(p->assoc.first, key)) {
+          p = p->right.get();
+        } else {
+          return p;
+        }
+      }
+      return nullptr;
+    }
+
+    /**
+     * @brief Return a balanced tree of the associations with indices in
+     * the half open range [first, last) of the input, which are in order.
+     */
+    static pointer
+    build(
+      vector<assoc_type const*> const& assocs,
+      index_type first,
+      index_type last) {
+      if (first >= last) {
+        return {};
+      }
+      index_type middle = first + (last - first) / 2;
+      return makeNode(
+        *assocs[middle],
+        build(assocs, first, middle),
+        build(assocs, middle + 1, last));
+    }
+
+    template<typename F>
+    static void
+    doEntriesAux(pointer const& p, F& f) {
+      if (!p) {
+        return;
+      }
+      doEntriesAux(p->left, f);
+      f(p->assoc);
+      doEntriesAux(p->right, f);
+    }
+
+    template<typename F>
+    auto
+    listOf(F f) const {
+      using U = decay_t<invoke_result_t<F, assoc_type const&>>;
+      vector<assoc_type const*> assocs{};
+      doEntries(*this, [&](assoc_type const& assoc) {
+        assocs.push_back(&assoc);
+      });
+      ListType<U> result{};
+      for (auto assoc = assocs.rbegin(); assoc != assocs.rend(); ++assoc) {
+        result = cons(U(f(**assoc)), result);
+      }
+      return result;
+    }
+
+  public:
+    /**
+     * @brief Construct a map with the associations of an `AList`
+     *
+     * @details When a key occurs more than once, the first association,
+     * which is the one an `AList` would find, is kept.
+     */
+    explicit OrderedMap(AList<K, T> const& xs) {
+      vector<assoc_type const*> assocs{};
+      auto data = xs.toList();
+      doList(data, [&](assoc_type const& assoc) { assocs.push_back(&assoc); });
+      std::stable_sort(
+        assocs.begin(),
+        assocs.end(),
+        [](assoc_type const* x, assoc_type const* y) {
+          return less(x->first, y->first);
+        });
+      auto last = std::unique(
+        assocs.begin(),
+        assocs.end(),
+        [](assoc_type const* x, assoc_type const* y) {
+          return !less(x->first, y->first);
+        });
+      assocs.erase(last, assocs.end());
+      root = build(assocs, 0, index_type(assocs.size()));
+    }
+
+    /**
+     * @brief Return a map like this map, with the input value associated
+     * with the input key, replacing any value the key had.
+     */
+    OrderedMap
+    set(K const& key, T const& value) const {
+      return OrderedMap(insertAux(root, key, value));
+    }
+
+    /**
+     * @brief Return a map like the input map, with the input value
+     * associated with the input key, replacing any value the key had.
+     */
+    friend OrderedMap
+    set(K const& key, T const& value, OrderedMap const& xs) {
+      return xs.set(key, value);
+    }
+
+    /**
+     * @brief Return a map like this map, without the input key
+     */
+    OrderedMap
+    unset(K const& key) const {
+      return OrderedMap(eraseAux(root, key));
+    }
+
+    /**
+     * @brief Return a map like the input map, without the input key
+     */
+    friend OrderedMap
+    unset(K const& key, OrderedMap const& xs) {
+      return xs.unset(key);
+    }
+
+    /**
+     * @brief Return a map like this map, without the input key
+     *
+     * @details Keys are unique in an `OrderedMap`, so this is the same as
+     * `unset`.
+     */
+    OrderedMap
+    remove(K const& key) const {
+      return unset(key);
+    }
+
+    /**
+     * @brief Return a map like the input map, without the input key
+     */
+    friend OrderedMap
+    remove(K const& key, OrderedMap const& xs) {
+      return xs.unset(key);
+    }
+
+    /**
+     * @brief Return `true` if this map has the input key and `false` if
+     * it does not.
+     */
+    bool
+    hasKey(K const& key) const {
+      return find(key) != nullptr;
+    }
+
+    /**
+     * @brief Return `true` if the input map has the input key and `false`
+     * if it does not.
+     */
+    friend bool
+    hasKey(K const& key, OrderedMap const& xs) {
+      return xs.hasKey(key);
+    }
+
+    /**
+     * @brief Return the value associated with an input key in this map,
+     * or an alternate value if the map does not have the key.
+     */
+    T
+    forceGet(K const& key, T const& alternate) const {
+      Node const* p = find(key);
+      return p ? p->assoc.second : alternate;
+    }
+
+    /**
+     * @brief Return the value associated with an input key in the input
+     * map, or an alternate value if the map does not have the key.
+     */
+    friend T
+    forceGet(K const& key, T const& alternate, OrderedMap const& xs) {
+      return xs.forceGet(key, alternate);
+    }
+
+    /**
+     * @brief Return an optional value associated with an input key in
+     * this map.
+     */
+    optional<T>
+    maybeGet(K const& key) const {
+      Node const* p = find(key);
+      return p ? optional<T>(p->assoc.second) : optional<T>();
+    }
+
+    /**
+     * @brief Return an optional value associated with an input key in
+     * the input map.
+     */
+    friend optional<T>
+    maybeGet(K const& key, OrderedMap const& xs) {
+      return xs.maybeGet(key);
+    }
+
+    /**
+     * @brief Return the value associated with an input key in this map,
+     * throwing `logic_error` if the map does not have the key.
+     */
+    T
+    tryGet(K const& key) const {
+      Node const* p = find(key);
+      if (!p) {
+        throw logic_error("OrderedMap does not have requested key!");
+      }
+      return p->assoc.second;
+    }
+
+    /**
+     * @brief Return the value associated with an input key in the input
+     * map, throwing `logic_error` if the map does not have the key.
+     */
+    friend T
+    tryGet(K const& key, OrderedMap const& xs) {
+      return xs.tryGet(key);
+    }
+
+    bool
+    hasData() const {
+      return bool(root);
+    }
+
+    friend bool
+    hasData(OrderedMap const& xs) {
+      return xs.hasData();
+    }
+
+    bool
+    isEmpty() const {
+      return !root;
+    }
+
+    friend bool
+    isEmpty(OrderedMap const& xs) {
+      return xs.isEmpty();
+    }
+
+    /**
+     * @brief Return the number of associations in this map
+     */
+    size_type
+    length() const {
+      return sizeOf(root);
+    }
+
+    /**
+     * @brief Return the number of associations in the input map
+     */
+    friend size_type
+    length(OrderedMap const& xs) {
+      return xs.length();
+    }
+
+    /**
+     * @brief Return the association with the least key in this map
+     */
+    optional<assoc_type>
+    min() const {
+      Node const* p = root.get();
+      if (!p) {
+        return nullopt;
+      }
+      while (p->left) {
+        p = p->left.get();
+      }
+      return p->assoc;
+    }
+
+    /**
+     * @brief Return the association with the greatest key in this map
+     */
+    optional<assoc_type>
+    max() const {
+      Node const* p = root.get();
+      if (!p) {
+        return nullopt;
+      }
+      while (p->right) {
+        p = p->right.get();
+      }
+      return p->assoc;
+    }
+
+    /**
+     * @brief Return the association with the least key that is not less
+     * than the input key
+     */
+    optional<assoc_type>
+    lowerBound(K const& key) const {
+      Node const* result = nullptr;
+      for (Node const* p = root.get(); p;) {
+        if (less(p->assoc.first, key)) {
+          p = p->right.get();
+        } else {
+          result = p;
+          p = p->left.get();
+        }
+      }
+      return result ? optional<assoc_type>(result->assoc) : nullopt;
+    }
+
+    /**
+     * @brief Return the association with the least key that is greater
+     * than the input key
+     */
+    optional<assoc_type>
+    upperBound(K const& key) const {
+      Node const* result = nullptr;
+      for (Node const* p = root.get(); p;) {
+        if (less(key, p->assoc.first)) {
+          result = p;
+          p = p->left.get();
+        } else {
+          p = p->right.get();
+        }
+      }
+      return result ? optional<assoc_type>(result->assoc) : nullopt;
+    }
+
+    /**
+     * @brief Return the maps of the associations of this map with keys
+     * less than and greater than the input key, and the value associated
+     * with the key, if any.
+     */
+    tuple<OrderedMap, optional<T>, OrderedMap>
+    split(K const& key) const {
+      auto [l, found, r] = splitAux(root, key);
+      return {
+        OrderedMap(l),
+        found ? optional<T>(found->second) : optional<T>(),
+        OrderedMap(r)};
+    }
+
+    /**
+     * @brief Split the input map at the input key
+     */
+    friend tuple<OrderedMap, optional<T>, OrderedMap>
+    split(K const& key, OrderedMap const& xs) {
+      return xs.split(key);
+    }
+
+    /**
+     * @brief Return a map with the associations of this map and the input
+     * map, all of whose keys must be greater than those of this map,
+     * throwing `logic_error` if they are not.
+     */
+    OrderedMap
+    join(OrderedMap const& ys) const {
+      if (root && ys.root && !less(max()->first, ys.min()->first)) {
+        throw logic_error("OrderedMap cannot join maps with unordered keys!");
+      }
+      return OrderedMap(merge(root, ys.root));
+    }
+
+    /**
+     * @brief Return a map with the associations of the input maps, where
+     * the keys of the first all precede those of the second.
+     */
+    friend OrderedMap
+    join(OrderedMap const& xs, OrderedMap const& ys) {
+      return xs.join(ys);
+    }
+
+    /**
+     * @brief Return a map of the associations of this map with keys in
+     * the half open range [first, last).
+     */
+    OrderedMap
+    range(K const& first, K const& last) const {
+      if (!less(first, last)) {
+        return OrderedMap{};
+      }
+      auto [below, found, rest] = splitAux(root, first);
+      pointer from_first =
+        found ? insertAux(rest, found->first, found->second) : rest;
+      return OrderedMap(get<0>(splitAux(from_first, last)));
+    }
+
+    /**
+     * @brief Return a map of the associations of the input map with keys
+     * in the half open range [first, last).
+     */
+    friend OrderedMap
+    range(K const& first, K const& last, OrderedMap const& xs) {
+      return xs.range(first, last);
+    }
+
+    /**
+     * @brief Call a function with each association of the input map, by
+     * reference, in the order of the keys.
+     */
+    template<typename F>
+    friend F
+    doEntries(OrderedMap const& xs, F f) {
+      doEntriesAux(xs.root, f);
+      return f;
+    }
+
+    /**
+     * @brief Return the keys of this map, in order
+     */
+    auto
+    keys() const {
+      return listOf([](assoc_type const& assoc) { return assoc.first; });
+    }
+
+    friend auto
+    keys(OrderedMap const& xs) {
+      return xs.keys();
+    }
+
+    /**
+     * @brief Return the values of this map, in the order of their keys
+     */
+    auto
+    vals() const {
+      return listOf([](assoc_type const& assoc) { return assoc.second; });
+    }
+
+    friend auto
+    vals(OrderedMap const& xs) {
+      return xs.vals();
+    }
+
+    /**
+     * @brief Return the associations of this map, in the order of their
+     * keys
+     */
+    auto
+    toList() const {
+      return listOf([](assoc_type const& assoc) { return assoc; });
+    }
+
+    friend auto
+    toList(OrderedMap const& xs) {
+      return xs.toList();
+    }
+
+    /**
+     * @brief Return true if the maps have the same associations
+     */
+    friend bool
+    operator==(OrderedMap const& xs, OrderedMap const& ys) {
+      return xs.length() == ys.length() && xs.toList() == ys.toList();
+    }
+
+    friend bool
+    operator!=(OrderedMap const& xs, OrderedMap const& ys) {
+      return !(xs == ys);
+    }
+
+  }; // end of class OrderedMap
+
+  template<typename K, typename T>
+  inline constinit const OrderedMap<K, T> empty_ordered_map{};
+
+  /**
+   * @brief Return an `OrderedMap` of the input associations, where the
+   * first association of a key takes precedence
+   */
+  template<typename... Ks, typename... Vs>
+  auto
+  orderedMap(pair<Ks, Vs> const&... pairs) {
+    using K = common_type_t<Ks...>;
+    using V = common_type_t<Vs...>;
+    return OrderedMap<K, V>(alist(pair<K, V>(pairs)...));
+  }
+
+} // end of namespace ListProcessing::Dynamic::Details
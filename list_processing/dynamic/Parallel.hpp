@@ -0,0 +1,260 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/config.hpp>
+#include <list_processing/dynamic/List.hpp>
+#include <list_processing/dynamic/ThreadPool.hpp>
+#include <list_processing/dynamic/import.hpp>
+
+namespace ListProcessing::Dynamic::Details {
+
+  /**
+   * @brief The default minimum number of elements processed by a single
+   * task of a parallel list operation.
+   */
+  constexpr size_type default_grain_size =
+    ListProcessing::Config::Info::Parameters::default_grain_size;
+
+  /**
+   * @brief A partition of the elements of a list into tasks.
+   *
+   * @details The list is split on chunk boundaries, so a task covers
+   * whole chunks and at least `grain` elements, except for the last task.
+   * The partition refers to the chunks of the input list, which must
+   * outlive it.
+   */
+  template<typename T, size_type N>
+  class Partition {
+  public:
+    using Unit = conditional_t<N == 1, T, ShortList<T, N>>;
+
+    Partition(List<T, N> const& xs, size_type grain) {
+      size_type count = 0;
+      auto add = [&](Unit const& unit, size_type length) {
+        if (count == 0) {
+          bounds.push_back(size_type(units.size()));
+        }
+        units.push_back(&unit);
+        count += length;
+        if (count >= grain) {
+          count = 0;
+        }
+      };
+      if constexpr (N == 1) {
+        doList(xs, [&](T const& x) { add(x, 1); });
+      } else {
+        doChunks(xs, [&](Unit const& chunk) { add(chunk, chunk.length()); });
+      }
+      bounds.push_back(size_type(units.size()));
+    }
+
+    size_type
+    tasks() const {
+      return size_type(bounds.size()) - 1;
+    }
+
+    /**
+     * @brief Call a function with each element covered by a task
+     */
+    template<typename F>
+    void
+    forEach(index_type task, F f) const {
+      for (index_type i = bounds[task]; i < bounds[task + 1]; ++i) {
+        if constexpr (N == 1) {
+          f(*units[i]);
+        } else {
+          for (index_type j = 0, n = units[i]->length(); j < n; ++j) {
+            f(units[i]->listRef(j));
+          }
+        }
+      }
+    }
+
+  private:
+    vector<Unit const*> units{};
+    vector<index_type> bounds{};
+  };
+
+  /**
+   * @brief Return a list of the values returned by the input accessor for
+   * each index in the half open range [0, m), in order.
+   *
+   * @details For chunked lists, the chunks are built in parallel and only
+   * the linking of the chunks is sequential.
+   */
+  template<typename U, size_type M, invocable<index_type> At>
+  List<U, M>
+  assembleList(size_type m, At at, size_type grain) {
+    if constexpr (M == 1) {
+      List<U, M> result{};
+      for (index_type i = m - 1; i >= 0; --i) {
+        result = cons(at(i), result);
+      }
+      return result;
+    } else {
+      using Datum = ShortList<U, M>;
+      using Data = List<Datum, 1>;
+
+      if (m == 0) {
+        return List<U, M>{};
+      }
+
+      // The head chunk takes the remainder, so the others are full.
+      size_type head_size = m % M == 0 ? M : m % M;
+      size_type chunk_count = 1 + (m - head_size) / M;
+
+      vector<optional<Datum>> chunks(chunk_count);
+      size_type chunks_per_task = std::max(grain / M, size_type(1));
+      size_type task_count =
+        (chunk_count + chunks_per_task - 1) / chunks_per_task;
+      ThreadPool::global().parallelFor(task_count, [&](index_type task) {
+        index_type last = std::min((task + 1) * chunks_per_task, chunk_count);
+        for (index_type c = task * chunks_per_task; c < last; ++c) {
+          index_type start = c == 0 ? 0 : head_size + (c - 1) * M;
+          size_type length = c == 0 ? head_size : M;
+          chunks[c].emplace(buildShortList<U, M>(
+            [&](index_type i) { return at(start + i); }, length));
+        }
+      });
+
+      Data data = Data::nil;
+      for (index_type c = chunk_count - 1; c >= 0; --c) {
+        data = cons(*chunks[c], data);
+      }
+      return List<U, M>(data);
+    }
+  }
+
+  /**
+   * @brief Return a list of the values of the input segments, in order.
+   */
+  template<typename U, size_type M>
+  List<U, M>
+  assembleList(vector<vector<U>> const& segments, size_type grain) {
+    vector<size_type> offsets{0};
+    for (auto const& segment : segments) {
+      offsets.push_back(offsets.back() + size_type(segment.size()));
+    }
+    return assembleList<U, M>(
+      offsets.back(),
+      [&](index_type index) -> U const& {
+        index_type segment =
+          std::upper_bound(offsets.begin(), offsets.end(), index) -
+          offsets.begin() - 1;
+        return segments[segment][index - offsets[segment]];
+      },
+      grain);
+  }
+
+  /**
+   * @brief Return a list of the results of applying the input function to
+   * each element of the input list, computed in parallel.
+   *
+   * @details The work is split on chunk boundaries into tasks of at least
+   * `grain` elements, which run on the global `ThreadPool`.
+   */
+  class ParallelMap : public Static_callable<ParallelMap> {
+  public:
+    template<
+      typename F,
+      typename T,
+      size_type N,
+      typename U = decay_t<invoke_result_t<F, T const&>>>
+    static ListType<U>
+    call(F f, List<T, N> const& xs, size_type grain = default_grain_size) {
+      Partition<T, N> partition(xs, grain);
+      vector<vector<U>> segments(partition.tasks());
+      ThreadPool::global().parallelFor(partition.tasks(), [&](index_type task) {
+        partition.forEach(
+          task, [&](T const& x) { segments[task].push_back(f(x)); });
+      });
+      return assembleList<U, ListTraits<U>::chunk_size>(segments, grain);
+    }
+
+    /**
+     * @brief Dispatch to collections that implement their own parallel
+     * map, such as `Tree`.
+     */
+    template<typename F, typename C>
+      requires requires(F f, C const& xs, size_type grain) {
+        xs.parallelMap(f, grain);
+      }
+    static auto
+    call(F f, C const& xs, size_type grain = default_grain_size) {
+      return xs.parallelMap(f, grain);
+    }
+  } constexpr parallelMap{};
+
+  /**
+   * @brief Return the result of combining the elements of the input list
+   * with the input function, computed in parallel.
+   *
+   * @details The function must be associative, because each task combines
+   * its own elements before the partial results are combined, in order,
+   * starting from `init`.
+   */
+  class ParallelReduce : public Static_callable<ParallelReduce> {
+  public:
+    template<typename F, typename U, typename T, size_type N>
+    static U
+    call(
+      F f,
+      U const& init,
+      List<T, N> const& xs,
+      size_type grain = default_grain_size) {
+      Partition<T, N> partition(xs, grain);
+      vector<optional<U>> partials(partition.tasks());
+      ThreadPool::global().parallelFor(partition.tasks(), [&](index_type task) {
+        optional<U>& partial = partials[task];
+        partition.forEach(task, [&](T const& x) {
+          partial = partial ? U(f(*partial, x)) : U(x);
+        });
+      });
+      U result = init;
+      for (optional<U> const& partial : partials) {
+        result = f(result, *partial);
+      }
+      return result;
+    }
+
+    /**
+     * @brief Dispatch to collections that implement their own parallel
+     * reduction, such as `Tree`.
+     */
+    template<typename F, typename U, typename C>
+      requires requires(F f, U const& init, C const& xs, size_type grain) {
+        xs.parallelReduce(f, init, grain);
+      }
+    static U
+    call(
+      F f, U const& init, C const& xs, size_type grain = default_grain_size) {
+      return xs.parallelReduce(f, init, grain);
+    }
+  } constexpr parallelReduce{};
+
+  /**
+   * @brief Return a list of the elements of the input list that satisfy
+   * the input predicate, computed in parallel.
+   */
+  class ParallelFilter : public Static_callable<ParallelFilter> {
+  public:
+    template<typename Pred, typename T, size_type N>
+    static List<T, N>
+    call(
+      Pred pred, List<T, N> const& xs, size_type grain = default_grain_size) {
+      Partition<T, N> partition(xs, grain);
+      vector<vector<T>> segments(partition.tasks());
+      ThreadPool::global().parallelFor(partition.tasks(), [&](index_type task) {
+        partition.forEach(task, [&](T const& x) {
+          if (pred(x)) {
+            segments[task].push_back(x);
+          }
+        });
+      });
+      return assembleList<T, N>(segments, grain);
+    }
+  } constexpr parallelFilter{};
+
+} // end of namespace ListProcessing::Dynamic::Details
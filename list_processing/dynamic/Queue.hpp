@@ -19,9 +19,9 @@ namespace ListProcessing::Dynamic::Details {
     using reference = value_type&;
     using const_reference = value_type const&;
 
-    Queue()
-      : input(nil<value_type>)
-      , output(nil<value_type>)
+    constexpr Queue()
+      : input()
+      , output()
     {}
 
   private:
@@ -35,6 +35,9 @@ namespace ListProcessing::Dynamic::Details {
     data_type input;
     data_type output;
 
+    template<typename U>
+    friend struct Serializer;
+
     //  _    ___            _
     // (_)__| __|_ __  _ __| |_ _  _
     // | (_-< _|| '  \| '_ \  _| || |
@@ -188,7 +191,7 @@ namespace ListProcessing::Dynamic::Details {
   }; // end of class Queue
 
   template<typename T>
-  inline const Queue<T> empty_queue{};
+  inline constinit const Queue<T> empty_queue{};
 
   /**
    * @brief Insert the elements of a list into a queue.
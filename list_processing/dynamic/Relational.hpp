@@ -0,0 +1,326 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/AList.hpp>
+#include <list_processing/dynamic/HashTable.hpp>
+#include <list_processing/dynamic/List.hpp>
+#include <list_processing/dynamic/Stream.hpp>
+#include <list_processing/dynamic/import.hpp>
+
+namespace ListProcessing::Dynamic::Details {
+
+  /**
+   * @brief Call a function with each element of an input list, by
+   * reference.
+   */
+  template<typename T, size_type N, typename F>
+  void
+  forEachElement(List<T, N> const& xs, F f) {
+    doList(xs, f);
+  }
+
+  /**
+   * @brief Call a function with each element of an input stream, by
+   * reference.
+   */
+  template<typename T, typename F>
+  void
+  forEachElement(Stream<T> const& xs, F f) {
+    doStream(xs, f);
+  }
+
+  /**
+   * @brief Return the elements of a vector of pointers as a list, in order.
+   */
+  template<typename R, typename P, typename F>
+  ListType<R>
+  listFromBack(vector<P> const& items, F f) {
+    ListType<R> result{};
+    for (auto item = items.rbegin(); item != items.rend(); ++item) {
+      result = cons(R(f(*item)), result);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Return the position of the input key in the input index,
+   * adding the key at the next position if it is not present.
+   *
+   * @details The positions index vectors kept beside the table, so that
+   * the table maps each key once and is never updated for a key it
+   * already has.
+   */
+  template<typename K>
+  pair<index_type, bool>
+  indexKey(HashTable<K, index_type>& index, K const& key, index_type next) {
+    if (auto position = index.maybeGet(key)) {
+      return {*position, false};
+    }
+    index = index.set(key, next);
+    return {next, true};
+  }
+
+  /**
+   * @brief Return an association list from each key returned by the input
+   * function to the list of elements of the input collection with that key.
+   *
+   * @details The groups appear in the order of the first occurrence of
+   * their keys, and the elements of a group keep their relative order.  The
+   * collection is traversed once, with the groups collected in a
+   * `HashTable` index.
+   */
+  template<
+    typename F,
+    typename C,
+    typename T = typename C::value_type,
+    typename K = decay_t<invoke_result_t<F, T const&>>>
+  AList<K, ListType<T>>
+  hashGroupBy(F key, C const& xs) {
+    HashTable<K, index_type> index{};
+    vector<K> keys{};
+    vector<vector<T const*>> groups{};
+    forEachElement(xs, [&](T const& x) {
+      K k = key(x);
+      auto [position, inserted] =
+        indexKey(index, k, index_type(keys.size()));
+      if (inserted) {
+        keys.push_back(std::move(k));
+        groups.emplace_back();
+      }
+      groups[size_t(position)].push_back(&x);
+    });
+
+    using Assoc = pair<K, ListType<T>>;
+    ListType<Assoc> result{};
+    for (index_type i = index_type(keys.size()) - 1; i >= 0; --i) {
+      result = cons(
+        Assoc{keys[i], listFromBack<T>(groups[i], [](T const* x) -> T const& {
+                return *x;
+              })},
+        result);
+    }
+    return AList<K, ListType<T>>(result);
+  }
+
+  /**
+   * @brief Return an association list from each key returned by the input
+   * function to the number of elements of the input collection with that
+   * key, in the order of the first occurrence of the keys.
+   */
+  template<
+    typename F,
+    typename C,
+    typename T = typename C::value_type,
+    typename K = decay_t<invoke_result_t<F, T const&>>>
+  AList<K, size_type>
+  hashCountBy(F key, C const& xs) {
+    HashTable<K, index_type> index{};
+    vector<K> keys{};
+    vector<size_type> counts{};
+    forEachElement(xs, [&](T const& x) {
+      K k = key(x);
+      auto [position, inserted] =
+        indexKey(index, k, index_type(keys.size()));
+      if (inserted) {
+        keys.push_back(std::move(k));
+        counts.push_back(0);
+      }
+      ++counts[size_t(position)];
+    });
+
+    using Assoc = pair<K, size_type>;
+    ListType<Assoc> result{};
+    for (index_type i = index_type(keys.size()) - 1; i >= 0; --i) {
+      result = cons(Assoc{keys[i], counts[i]}, result);
+    }
+    return AList<K, size_type>(result);
+  }
+
+  /**
+   * @brief Return a list of the first occurrences of the elements of the
+   * input list, in order.
+   */
+  template<typename T, size_type N>
+  List<T, N>
+  hashDistinct(List<T, N> const& xs) {
+    HashTable<T, bool> seen{};
+    vector<T const*> kept{};
+    doList(xs, [&](T const& x) {
+      if (!seen.hasKey(x)) {
+        seen = seen.set(x, true);
+        kept.push_back(&x);
+      }
+    });
+    List<T, N> result{};
+    for (auto x = kept.rbegin(); x != kept.rend(); ++x) {
+      result = cons(**x, result);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Return a stream of the first occurrences of the elements of the
+   * input stream, in order.
+   *
+   * @details The result is lazy.  The elements seen so far are recorded in
+   * a `HashTable` shared by the cells of the result, which are forced in
+   * order, each exactly once.
+   */
+  template<typename T>
+  Stream<T>
+  hashDistinct(Stream<T> const& xs) {
+    auto seen = make_shared<HashTable<T, bool>>();
+    auto recur = [seen](auto recur, Stream<T> xs) -> Stream<T> {
+      return Stream<T>{[=]() -> Stream<T> {
+        Stream<T> rest = xs;
+        while (rest.hasData() && seen->hasKey(*rest.head())) {
+          rest = rest.tail();
+        }
+        if (rest.hasData()) {
+          *seen = seen->set(*rest.head(), true);
+        }
+        return rest.hasData()
+                 ? Stream<T>{rest.head(), recur(recur, rest.tail())}
+                 : Stream<T>{};
+      }};
+    };
+    return recur(recur, xs);
+  }
+
+  /**
+   * @brief A hash index of the elements of a collection by key, used as
+   * the right-hand side of a join.
+   *
+   * @details The index holds the collection, so the indexed elements
+   * are referred to by pointer.  A `HashTable` maps each key to the
+   * position of its group of elements.
+   */
+  template<typename K, typename Ys>
+  class JoinIndex {
+  public:
+    using value_type = typename Ys::value_type;
+
+    template<typename F>
+    JoinIndex(F key, Ys input_ys)
+      : ys{input_ys} {
+      forEachElement(ys, [&](value_type const& y) {
+        auto [position, inserted] =
+          indexKey(index, key(y), index_type(groups.size()));
+        if (inserted) {
+          groups.emplace_back();
+        }
+        groups[size_t(position)].push_back(&y);
+      });
+    }
+
+    vector<value_type const*> const*
+    find(K const& key) const {
+      auto position = index.maybeGet(key);
+      return position ? &groups[size_t(*position)] : nullptr;
+    }
+
+  private:
+    Ys ys;
+    HashTable<K, index_type> index{};
+    vector<vector<value_type const*>> groups{};
+  };
+
+  template<typename T, typename U, bool Left>
+  using JoinResult = pair<T, conditional_t<Left, optional<U>, U>>;
+
+  template<
+    bool Left,
+    typename F,
+    typename T,
+    size_type N,
+    typename Ys,
+    typename U = typename Ys::value_type,
+    typename K = decay_t<invoke_result_t<F, T const&>>>
+  ListType<JoinResult<T, U, Left>>
+  hashJoin(F key, List<T, N> const& xs, Ys const& ys) {
+    using Result = JoinResult<T, U, Left>;
+    JoinIndex<K, Ys> index(key, ys);
+    vector<pair<T const*, U const*>> matches{};
+    doList(xs, [&](T const& x) {
+      if (auto found = index.find(key(x))) {
+        for (U const* y : *found) {
+          matches.emplace_back(&x, y);
+        }
+      } else if constexpr (Left) {
+        matches.emplace_back(&x, nullptr);
+      }
+    });
+    return listFromBack<Result>(matches, [](pair<T const*, U const*> match) {
+      if constexpr (Left) {
+        return Result{
+          *match.first,
+          match.second ? optional<U>(*match.second) : optional<U>()};
+      } else {
+        return Result{*match.first, *match.second};
+      }
+    });
+  }
+
+  template<
+    bool Left,
+    typename F,
+    typename T,
+    typename Ys,
+    typename U = typename Ys::value_type,
+    typename K = decay_t<invoke_result_t<F, T const&>>>
+  Stream<JoinResult<T, U, Left>>
+  hashJoin(F key, Stream<T> const& xs, Ys const& ys) {
+    using Result = JoinResult<T, U, Left>;
+    auto index = make_shared<const JoinIndex<K, Ys>>(key, ys);
+    auto recur = [=](auto recur, Stream<T> xs) -> Stream<Result> {
+      return Stream<Result>{[=]() -> Stream<Result> {
+        Stream<T> rest = xs;
+        while (rest.hasData()) {
+          auto head = rest.head();
+          T const& x = *head;
+          if (auto found = index->find(key(x))) {
+            Stream<Result> result = recur(recur, rest.tail());
+            for (auto y = found->rbegin(); y != found->rend(); ++y) {
+              result = Stream<Result>{Result{x, **y}, result};
+            }
+            return result;
+          } else if constexpr (Left) {
+            return Stream<Result>{
+              Result{x, nullopt}, recur(recur, rest.tail())};
+          }
+          rest = rest.tail();
+        }
+        return Stream<Result>{};
+      }};
+    };
+    return recur(recur, xs);
+  }
+
+  /**
+   * @brief Return the pairs of elements of the input collections that have
+   * equal keys, in the order of the left-hand collection.
+   *
+   * @details The right-hand collection is indexed in a `HashTable`, so
+   * the join takes one lookup per left-hand element.  When the
+   * left-hand collection is a stream, the result is a lazy stream.
+   */
+  template<typename F, typename Xs, typename Ys>
+  auto
+  hashInnerJoin(F key, Xs const& xs, Ys const& ys) {
+    return hashJoin<false>(key, xs, ys);
+  }
+
+  /**
+   * @brief Return the pairs of elements of the input collections that have
+   * equal keys, with each left-hand element that has no match paired with
+   * an empty optional.
+   */
+  template<typename F, typename Xs, typename Ys>
+  auto
+  hashLeftJoin(F key, Xs const& xs, Ys const& ys) {
+    return hashJoin<true>(key, xs, ys);
+  }
+
+} // end of namespace ListProcessing::Dynamic::Details
@@ -0,0 +1,461 @@
+#pragma once
+
+//
+// ... Standard header files
+//
+#include <charconv>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/Arena.hpp>
+#include <list_processing/dynamic/TList.hpp>
+#include <list_processing/dynamic/Value.hpp>
+#include <list_processing/dynamic/import.hpp>
+
+namespace ListProcessing::Dynamic::Details {
+
+  /**
+   * @brief Return true if the input character ends an atom
+   */
+  constexpr bool
+  isSExpressionDelimiter(char c)
+  {
+    switch (c) {
+      case ' ':
+      case '\t':
+      case '\n':
+      case '\r':
+      case '\f':
+      case '\v':
+      case '(':
+      case ')':
+      case '"':
+      case ';':
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  /**
+   * @brief A class template describing how the atoms of S-expressions are
+   * read and printed
+   *
+   * @details An atom is either a bare token, read with `parse`, or a
+   * string literal, whose unescaped text is read with `parseString`.
+   * Arithmetic atoms are written with `std::to_chars`, so that they read
+   * back as the same value, and booleans are written `#t` and `#f`.
+   * String atoms are written bare when they read back as the same token,
+   * and quoted otherwise.  Specializations for other types provide the
+   * same three static functions.
+   */
+  template<typename T>
+  struct SExpressionAtom
+  {
+    static T
+    parse(string_view token)
+    {
+      if constexpr (is_same_v<T, bool>) {
+        if (token == "#t") {
+          return true;
+        }
+        if (token == "#f") {
+          return false;
+        }
+      } else if constexpr (is_arithmetic_v<T>) {
+        T result{};
+        auto [end, error] =
+          std::from_chars(token.data(), token.data() + token.size(), result);
+        if (error == std::errc() && end == token.data() + token.size()) {
+          return result;
+        }
+      } else if constexpr (std::is_constructible_v<T, string_view>) {
+        return T(token);
+      }
+      throw logic_error("Invalid S-expression atom: " + string(token));
+    }
+
+    static T
+    parseString(string text)
+    {
+      if constexpr (std::is_constructible_v<T, string>) {
+        return T(std::move(text));
+      } else {
+        throw logic_error("S-expression string literal is not an atom");
+      }
+    }
+
+    static void
+    print(string& out, T const& x)
+    {
+      if constexpr (is_same_v<T, bool>) {
+        out += x ? "#t" : "#f";
+      } else if constexpr (is_arithmetic_v<T>) {
+        char buffer[64];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), x);
+        out.append(buffer, result.ptr);
+      } else {
+        string_view text(x);
+        bool bare = !text.empty() && text != "." &&
+                    std::none_of(text.begin(), text.end(), [](char c) {
+                      return isSExpressionDelimiter(c) || c == '\\';
+                    });
+        if (bare) {
+          out += text;
+        } else {
+          out += '"';
+          for (char c : text) {
+            switch (c) {
+              case '"':
+                out += "\\\"";
+                break;
+              case '\\':
+                out += "\\\\";
+                break;
+              case '\n':
+                out += "\\n";
+                break;
+              case '\t':
+                out += "\\t";
+                break;
+              default:
+                out += c;
+            }
+          }
+          out += '"';
+        }
+      }
+    }
+  };
+
+  /**
+   * @brief A reader of S-expressions into tree lists
+   *
+   * @details The reader scans its input once, without recursion, so the
+   * depth of nesting is limited only by memory.  The pairs and atoms it
+   * reads are allocated from an arena, which is shared by the expressions
+   * read and released when the last of them is released.  A list is
+   * written `(a b c)`, with an improper tail written `(a b . c)`, an atom
+   * is a token or a string literal in double quotes, and a comment runs
+   * from `;` to the end of the line.  Malformed input is reported with a
+   * `logic_error`.
+   */
+  template<typename T, typename Atom = SExpressionAtom<T>>
+  class SExpressionReader
+  {
+  public:
+    using construct_type = Construct<T>;
+    using Slot = typename construct_type::Slot;
+
+    explicit SExpressionReader(
+      string_view input, shared_ptr<Arena> arena = make_shared<Arena>())
+      : input(input)
+      , arena(std::move(arena))
+    {}
+
+    /**
+     * @brief Return true if only whitespace and comments remain
+     */
+    bool
+    isAtEnd()
+    {
+      skipSpace();
+      return pos == input.size();
+    }
+
+    /**
+     * @brief Return the next expression
+     */
+    Slot
+    read()
+    {
+      items.clear();
+      frames.clear();
+      for (;;) {
+        skipSpace();
+        if (pos == input.size()) {
+          throw logic_error(
+            frames.empty() ? "No S-expression to read"
+                           : "Unbalanced '(' in S-expression");
+        }
+        char c = input[pos];
+        if (c == '(') {
+          ++pos;
+          frames.push_back(Frame{items.size(), nullopt, false});
+          continue;
+        }
+        optional<Slot> x{};
+        if (c == ')') {
+          if (frames.empty()) {
+            fail("Unbalanced ')'");
+          }
+          ++pos;
+          x = Slot(close());
+        } else if (c == '"') {
+          x = atom(Atom::parseString(readString()));
+        } else {
+          string_view token = readToken();
+          if (token == ".") {
+            if (
+              frames.empty() || frames.back().dotted ||
+              items.size() == frames.back().start) {
+              fail("Misplaced '.'");
+            }
+            frames.back().dotted = true;
+            continue;
+          }
+          x = atom(Atom::parse(token));
+        }
+        if (frames.empty()) {
+          return std::move(*x);
+        }
+        Frame& frame = frames.back();
+        if (frame.dotted) {
+          if (frame.tail) {
+            fail("More than one expression after '.'");
+          }
+          frame.tail = std::move(x);
+        } else {
+          items.push_back(std::move(*x));
+        }
+      }
+    }
+
+  private:
+    using Kernel = typename construct_type::Kernel;
+
+    struct Frame
+    {
+      size_t start;
+      optional<Slot> tail;
+      bool dotted;
+    };
+
+    [[noreturn]] void
+    fail(string const& message) const
+    {
+      throw logic_error(
+        message + " in S-expression at offset " + to_string(pos));
+    }
+
+    void
+    skipSpace()
+    {
+      while (pos < input.size()) {
+        char c = input[pos];
+        if (c == ';') {
+          while (pos < input.size() && input[pos] != '\n') {
+            ++pos;
+          }
+        } else if (isSExpressionDelimiter(c) && c != '(' && c != ')' &&
+                   c != '"') {
+          ++pos;
+        } else {
+          return;
+        }
+      }
+    }
+
+    string_view
+    readToken()
+    {
+      size_t start = pos;
+      while (pos < input.size() && !isSExpressionDelimiter(input[pos])) {
+        ++pos;
+      }
+      return input.substr(start, pos - start);
+    }
+
+    string
+    readString()
+    {
+      string result{};
+      for (++pos; pos < input.size(); ++pos) {
+        char c = input[pos];
+        if (c == '"') {
+          ++pos;
+          return result;
+        }
+        if (c == '\\') {
+          if (++pos == input.size()) {
+            break;
+          }
+          switch (input[pos]) {
+            case 'n':
+              result += '\n';
+              break;
+            case 't':
+              result += '\t';
+              break;
+            default:
+              result += input[pos];
+          }
+        } else {
+          result += c;
+        }
+      }
+      fail("Unterminated string");
+    }
+
+    Slot
+    atom(T value)
+    {
+      return Slot(
+        Shared<T>(allocator_arg, ArenaAllocator<T>(arena), std::move(value)));
+    }
+
+    construct_type
+    close()
+    {
+      Frame frame = std::move(frames.back());
+      frames.pop_back();
+      if (frame.dotted && !frame.tail) {
+        fail("Missing expression after '.'");
+      }
+      construct_type result{};
+      Slot rest = frame.tail ? std::move(*frame.tail) : Slot(result);
+      ArenaAllocator<Kernel> alloc(arena);
+      for (size_t i = items.size(); i > frame.start; --i) {
+        result.ptr =
+          allocate_shared<Kernel>(alloc, std::move(items[i - 1]), rest);
+        rest = Slot(result);
+      }
+      items.erase(items.begin() + frame.start, items.end());
+      return result;
+    }
+
+    string_view input;
+    size_t pos{0};
+    shared_ptr<Arena> arena;
+    vector<Slot> items{};
+    vector<Frame> frames{};
+  };
+
+  /**
+   * @brief A printer of tree lists as S-expressions
+   *
+   * @details The printer walks the pairs without recursion, appending to
+   * a single string, and writes expressions that read back as equal
+   * expressions.
+   */
+  template<typename T, typename Atom = SExpressionAtom<T>>
+  class SExpressionPrinter
+  {
+  public:
+    using construct_type = Construct<T>;
+    using Slot = typename construct_type::Slot;
+
+    void
+    print(string& out, Slot const& x)
+    {
+      emit(out, x);
+      while (!pending.empty()) {
+        Pending& top = pending.back();
+        if (!top.rest) {
+          if (top.tail) {
+            out += " . ";
+            Atom::print(out, **top.tail);
+          }
+          out += ')';
+          pending.pop_back();
+          continue;
+        }
+        if (!top.first) {
+          out += ' ';
+        }
+        top.first = false;
+        Slot const& car = top.rest->car;
+        Slot const& cdr = top.rest->cdr;
+        if (holds_alternative<construct_type>(cdr)) {
+          top.rest = get<construct_type>(cdr).ptr.get();
+        } else {
+          top.rest = nullptr;
+          top.tail = &get<Shared<T>>(cdr);
+        }
+        emit(out, car);
+      }
+    }
+
+  private:
+    using Kernel = typename construct_type::Kernel;
+
+    struct Pending
+    {
+      Kernel const* rest;
+      Shared<T> const* tail;
+      bool first;
+    };
+
+    void
+    emit(string& out, Slot const& x)
+    {
+      if (holds_alternative<Shared<T>>(x)) {
+        Atom::print(out, *get<Shared<T>>(x));
+      } else if (Kernel const* p = get<construct_type>(x).ptr.get()) {
+        out += '(';
+        pending.push_back(Pending{p, nullptr, true});
+      } else {
+        out += "()";
+      }
+    }
+
+    vector<Pending> pending{};
+  };
+
+  /**
+   * @brief Return the single S-expression in the input text
+   */
+  template<typename T, typename Atom = SExpressionAtom<T>>
+  typename Construct<T>::Slot
+  readSExpression(
+    string_view input, shared_ptr<Arena> arena = make_shared<Arena>())
+  {
+    SExpressionReader<T, Atom> reader(input, std::move(arena));
+    auto result = reader.read();
+    if (!reader.isAtEnd()) {
+      throw logic_error("Trailing text after S-expression");
+    }
+    return result;
+  }
+
+  /**
+   * @brief Return a tree list of the S-expressions in the input text
+   */
+  template<typename T, typename Atom = SExpressionAtom<T>>
+  Construct<T>
+  readSExpressions(
+    string_view input, shared_ptr<Arena> arena = make_shared<Arena>())
+  {
+    SExpressionReader<T, Atom> reader(input, arena);
+    vector<typename Construct<T>::Slot> forms{};
+    while (!reader.isAtEnd()) {
+      forms.push_back(reader.read());
+    }
+    Construct<T> result{};
+    for (auto x = forms.rbegin(); x != forms.rend(); ++x) {
+      result = Construct<T>(std::move(*x), result);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Return the S-expression text of the input expression
+   */
+  template<typename T, typename Atom = SExpressionAtom<T>>
+  string
+  printSExpression(typename Construct<T>::Slot const& x)
+  {
+    string result{};
+    SExpressionPrinter<T, Atom>().print(result, x);
+    return result;
+  }
+
+  template<typename T>
+  string
+  printSExpression(Construct<T> const& xs)
+  {
+    return printSExpression<T>(typename Construct<T>::Slot(xs));
+  }
+
+} // end of namespace ListProcessing::Dynamic::Details
@@ -0,0 +1,879 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/AList.hpp>
+#include <list_processing/dynamic/Arena.hpp>
+#include <list_processing/dynamic/List.hpp>
+#include <list_processing/dynamic/Queue.hpp>
+#include <list_processing/dynamic/SerializerFwd.hpp>
+#include <list_processing/dynamic/Stack.hpp>
+#include <list_processing/dynamic/Symbol.hpp>
+#include <list_processing/dynamic/TList.hpp>
+#include <list_processing/dynamic/Tape.hpp>
+#include <list_processing/dynamic/Tree.hpp>
+#include <list_processing/dynamic/Value.hpp>
+#include <list_processing/dynamic/import.hpp>
+
+namespace ListProcessing::Dynamic::Details {
+
+  /**
+   * @brief The version of the binary format, written as its first byte
+   */
+  constexpr unsigned char serialization_version = 1;
+
+  /**
+   * @brief A writer of the binary format
+   *
+   * @details Every node written is given an identifier, in the order in
+   * which the nodes are written, and a node that is reached again is
+   * written as a reference to its identifier.  Several values written
+   * with the same encoder therefore share the nodes they have in common,
+   * and are read back sharing them.  The encoder keeps the nodes it has
+   * written alive, so that their addresses are not reused while it is in
+   * use.
+   */
+  class Encoder
+  {
+  public:
+    template<typename T>
+    void
+    encode(T const& x)
+    {
+      Serializer<T>::encode(*this, x);
+    }
+
+    void
+    writeByte(unsigned char x)
+    {
+      buffer.push_back(char(x));
+    }
+
+    /**
+     * @brief Write an unsigned integer with seven bits in each byte, the
+     * least significant first.
+     */
+    void
+    writeVarint(std::uint64_t x)
+    {
+      while (x >= 0x80) {
+        writeByte((x & 0x7f) | 0x80);
+        x >>= 7;
+      }
+      writeByte(x);
+    }
+
+    void
+    writeBytes(char const* data, size_type n)
+    {
+      buffer.append(data, n);
+    }
+
+    /**
+     * @brief Return the identifier of a node that has been written, if
+     * there is one.
+     */
+    optional<std::uint64_t>
+    find(void const* node) const
+    {
+      auto found = ids.find(node);
+      return found == ids.end() ? nullopt : optional(found->second);
+    }
+
+    /**
+     * @brief Give the input node the next identifier.
+     */
+    void
+    remember(shared_ptr<void const> node)
+    {
+      ids.emplace(node.get(), next_id++);
+      written.push_back(std::move(node));
+    }
+
+    string const&
+    bytes() const
+    {
+      return buffer;
+    }
+
+    string
+    release()
+    {
+      return std::move(buffer);
+    }
+
+  private:
+    string buffer{};
+    unordered_map<void const*, std::uint64_t> ids{};
+    vector<shared_ptr<void const>> written{};
+    std::uint64_t next_id{0};
+  };
+
+  /**
+   * @brief A reader of the binary format
+   *
+   * @details The nodes read are allocated from an arena, which is shared
+   * by the values read and released when the last of them is released.
+   * Malformed input is reported with a `logic_error`.
+   */
+  class Decoder
+  {
+  public:
+    explicit Decoder(
+      string_view input, shared_ptr<Arena> arena = make_shared<Arena>())
+      : input(input)
+      , arena(std::move(arena))
+    {}
+
+    template<typename T>
+    T
+    decode()
+    {
+      return Serializer<T>::decode(*this);
+    }
+
+    unsigned char
+    readByte()
+    {
+      if (pos == input.size()) {
+        throw logic_error("Serialized data is truncated");
+      }
+      return static_cast<unsigned char>(input[pos++]);
+    }
+
+    std::uint64_t
+    readVarint()
+    {
+      std::uint64_t result = 0;
+      for (unsigned shift = 0; shift < 64; shift += 7) {
+        unsigned char x = readByte();
+        result |= std::uint64_t(x & 0x7f) << shift;
+        if (!(x & 0x80)) {
+          return result;
+        }
+      }
+      throw logic_error("Serialized integer is too long");
+    }
+
+    /**
+     * @brief Read a count of the items that follow, each of which takes at
+     * least one byte.
+     */
+    size_type
+    readCount()
+    {
+      std::uint64_t n = readVarint();
+      if (n > remaining()) {
+        throw logic_error("Serialized data is truncated");
+      }
+      return size_type(n);
+    }
+
+    string_view
+    readBytes(size_type n)
+    {
+      if (size_type(remaining()) < n) {
+        throw logic_error("Serialized data is truncated");
+      }
+      string_view result = input.substr(pos, n);
+      pos += n;
+      return result;
+    }
+
+    size_t
+    remaining() const
+    {
+      return input.size() - pos;
+    }
+
+    bool
+    isAtEnd() const
+    {
+      return pos == input.size();
+    }
+
+    /**
+     * @brief Return an allocator taking storage from the arena
+     */
+    template<typename U>
+    ArenaAllocator<U>
+    allocator() const
+    {
+      return ArenaAllocator<U>(arena);
+    }
+
+    /**
+     * @brief Give the input node the next identifier.
+     */
+    template<typename U>
+    void
+    remember(shared_ptr<U const> node)
+    {
+      nodes.emplace_back(std::move(node), &typeid(U));
+    }
+
+    /**
+     * @brief Return the node with the input identifier
+     */
+    template<typename U>
+    shared_ptr<U const>
+    recall(std::uint64_t id) const
+    {
+      if (id >= nodes.size() || *nodes[id].second != typeid(U)) {
+        throw logic_error("Serialized data has an invalid node reference");
+      }
+      return static_pointer_cast<U const>(nodes[id].first);
+    }
+
+  private:
+    string_view input;
+    size_t pos{0};
+    shared_ptr<Arena> arena;
+    vector<pair<shared_ptr<void const>, std::type_info const*>> nodes{};
+  };
+
+  /**
+   * @brief Arithmetic and enumeration values, written in little endian
+   * order whatever the order of the host
+   */
+  template<typename T>
+    requires(is_arithmetic_v<T> || is_enum_v<T>)
+  struct Serializer<T>
+  {
+    static_assert(
+      sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+      "Serializer requires a value of 1, 2, 4 or 8 bytes");
+
+    using bits_type = UnsignedOfSize<sizeof(T)>;
+
+    static void
+    encode(Encoder& out, T x)
+    {
+      if constexpr (is_same_v<T, bool>) {
+        out.writeByte(x ? 1 : 0);
+      } else {
+        auto bits = bit_cast<bits_type>(x);
+        for (size_t i = 0; i < sizeof(T); ++i) {
+          out.writeByte((bits >> (8 * i)) & 0xff);
+        }
+      }
+    }
+
+    static T
+    decode(Decoder& in)
+    {
+      if constexpr (is_same_v<T, bool>) {
+        return in.readByte() != 0;
+      } else {
+        bits_type bits = 0;
+        for (size_t i = 0; i < sizeof(T); ++i) {
+          bits |= bits_type(in.readByte()) << (8 * i);
+        }
+        return bit_cast<T>(bits);
+      }
+    }
+  };
+
+  template<>
+  struct Serializer<string>
+  {
+    static void
+    encode(Encoder& out, string const& x)
+    {
+      out.writeVarint(x.size());
+      out.writeBytes(x.data(), x.size());
+    }
+
+    static string
+    decode(Decoder& in)
+    {
+      return string(in.readBytes(in.readCount()));
+    }
+  };
+
+  /**
+   * @brief Symbols are written as their text, and interned when read
+   */
+  template<>
+  struct Serializer<Symbol>
+  {
+    static void
+    encode(Encoder& out, Symbol const& x)
+    {
+      out.writeVarint(x.name().size());
+      out.writeBytes(x.name().data(), x.name().size());
+    }
+
+    static Symbol
+    decode(Decoder& in)
+    {
+      return Symbol(in.readBytes(in.readCount()));
+    }
+  };
+
+  template<typename A, typename B>
+  struct Serializer<pair<A, B>>
+  {
+    static void
+    encode(Encoder& out, pair<A, B> const& x)
+    {
+      out.encode(x.first);
+      out.encode(x.second);
+    }
+
+    static pair<A, B>
+    decode(Decoder& in)
+    {
+      A first = in.decode<A>();
+      return pair<A, B>(std::move(first), in.decode<B>());
+    }
+  };
+
+  template<typename T>
+  struct Serializer<Shared<T>>
+  {
+    static void
+    encode(Encoder& out, Shared<T> const& x)
+    {
+      out.encode(*x);
+    }
+
+    static Shared<T>
+    decode(Decoder& in)
+    {
+      return Shared<T>(in.decode<T>());
+    }
+  };
+
+  /**
+   * @brief Lists of single values
+   *
+   * @details A list is written as the number of its leading nodes that
+   * have not been written yet, their values, and a reference to the rest
+   * of the list: zero for the empty list, or one more than the identifier
+   * of a node that has been written.  The nodes are numbered from the end
+   * of the list, so the shared tail of two lists is written only with the
+   * first.
+   */
+  template<typename T>
+  struct Serializer<List<T, 1>>
+  {
+    using list_type = List<T, 1>;
+    using Kernel = typename list_type::Kernel;
+    using kernel_pointer = typename list_type::kernel_pointer;
+
+    static void
+    encode(Encoder& out, list_type const& xs)
+    {
+      vector<kernel_pointer const*> fresh{};
+      kernel_pointer const* p = &xs.ptr;
+      while (*p && !out.find(p->get())) {
+        fresh.push_back(p);
+        p = &(*p)->tail.ptr;
+      }
+      out.writeVarint(fresh.size());
+      for (kernel_pointer const* q : fresh) {
+        out.encode((*q)->head);
+      }
+      out.writeVarint(*p ? *out.find(p->get()) + 1 : 0);
+      for (auto q = fresh.rbegin(); q != fresh.rend(); ++q) {
+        out.remember(**q);
+      }
+    }
+
+    static list_type
+    decode(Decoder& in)
+    {
+      size_type n = in.readCount();
+      vector<T> values{};
+      values.reserve(n);
+      for (index_type i = 0; i < n; ++i) {
+        values.push_back(in.decode<T>());
+      }
+      std::uint64_t ref = in.readVarint();
+      list_type xs =
+        ref == 0 ? list_type() : list_type(in.recall<Kernel>(ref - 1));
+      auto alloc = in.allocator<Kernel>();
+      for (auto x = values.rbegin(); x != values.rend(); ++x) {
+        xs = list_type(kernel_pointer(allocate_shared<Kernel>(alloc, *x, xs)));
+        in.remember(xs.ptr);
+      }
+      return xs;
+    }
+  };
+
+  /**
+   * @brief The chunks of a chunked list, each written as its length
+   * followed by its values
+   */
+  template<typename T, size_type N>
+  struct Serializer<ShortList<T, N>>
+  {
+    using short_list_type = ShortList<T, N>;
+    using Kernel = typename short_list_type::Kernel;
+
+    static void
+    encode(Encoder& out, short_list_type const& xs)
+    {
+      out.writeVarint(xs.length());
+      for (index_type i = 0; i < xs.length(); ++i) {
+        out.encode(xs.listRef(i));
+      }
+    }
+
+    static short_list_type
+    decode(Decoder& in)
+    {
+      size_type n = in.readCount();
+      if (n < 1 || n > N) {
+        throw logic_error("Serialized chunk has an invalid length");
+      }
+      vector<T> values{};
+      values.reserve(n);
+      for (index_type i = 0; i < n; ++i) {
+        values.push_back(in.decode<T>());
+      }
+      auto kernel = allocate_shared<Kernel>(
+        in.allocator<Kernel>(),
+        [&](index_type i) { return values[i]; },
+        n,
+        build_tag{});
+      return short_list_type(kernel, n, false);
+    }
+  };
+
+  /**
+   * @brief Chunked lists, written as the list of their chunks
+   */
+  template<typename T, size_type N>
+  struct Serializer<List<T, N>>
+  {
+    using list_type = List<T, N>;
+
+    static void
+    encode(Encoder& out, list_type const& xs)
+    {
+      out.encode(xs.data);
+    }
+
+    static list_type
+    decode(Decoder& in)
+    {
+      return list_type(in.decode<typename list_type::Data>());
+    }
+  };
+
+  template<typename K, typename T>
+  struct Serializer<AList<K, T>>
+  {
+    using alist_type = AList<K, T>;
+
+    static void
+    encode(Encoder& out, alist_type const& xs)
+    {
+      out.encode(xs.toList());
+    }
+
+    static alist_type
+    decode(Decoder& in)
+    {
+      return alist_type(in.decode<typename alist_type::data_type>());
+    }
+  };
+
+  template<typename T>
+  struct Serializer<Stack<T>>
+  {
+    using stack_type = Stack<T>;
+
+    static void
+    encode(Encoder& out, stack_type const& xs)
+    {
+      out.encode(xs.data);
+    }
+
+    static stack_type
+    decode(Decoder& in)
+    {
+      return stack_type(in.decode<typename stack_type::data_type>());
+    }
+  };
+
+  template<typename T>
+  struct Serializer<Queue<T>>
+  {
+    using queue_type = Queue<T>;
+    using data_type = typename queue_type::data_type;
+
+    static void
+    encode(Encoder& out, queue_type const& xs)
+    {
+      out.encode(xs.input);
+      out.encode(xs.output);
+    }
+
+    static queue_type
+    decode(Decoder& in)
+    {
+      data_type input = in.decode<data_type>();
+      return queue_type(input, in.decode<data_type>());
+    }
+  };
+
+  template<typename T>
+  struct Serializer<Tape<T>>
+  {
+    using tape_type = Tape<T>;
+    using data_type = typename tape_type::data_type;
+
+    static void
+    encode(Encoder& out, tape_type const& xs)
+    {
+      out.encode(xs.data);
+      out.encode(xs.context);
+    }
+
+    static tape_type
+    decode(Decoder& in)
+    {
+      data_type data = in.decode<data_type>();
+      return tape_type(data, in.decode<data_type>());
+    }
+  };
+
+  /**
+   * @brief Trees with chunked branches
+   *
+   * @details A tree is written from its root, as the slots of the root
+   * branch: their number, then each slot as a tag, zero for a value
+   * followed by the value, or one for a branch followed by a reference.
+   * The reference is zero for a branch that has not been written yet,
+   * followed by its slots, or one more than the identifier of a branch
+   * that has been written.  A tree is read back open at its root, with
+   * every focus at the front, as `fromPreorder` returns it.
+   */
+  template<typename T, size_type N>
+    requires(N > 1)
+  struct Serializer<Tree<T, N>>
+  {
+    using tree_type = Tree<T, N>;
+    using Branch = typename tree_type::Branch;
+    using branch_pointer = typename tree_type::branch_pointer;
+    using node_type = typename tree_type::node_type;
+    using data_type = typename tree_type::data_type;
+
+    static void
+    encode(Encoder& out, tree_type const& xs)
+    {
+      tree_type ys = root(xs);
+      encodeSlots(out, ys.data);
+    }
+
+    static tree_type
+    decode(Decoder& in)
+    {
+      auto [data, size] = decodeSlots(in);
+      return tree_type(data, size, typename tree_type::Context{}, false);
+    }
+
+  private:
+    // The slots of a branch being written, with the position of the next
+    // slot to write.
+    struct EncodeFrame
+    {
+      branch_pointer const* branch;
+      vector<node_type const*> slots;
+      size_t next;
+    };
+
+    // The slots of a branch being read, with the number left to read.
+    struct DecodeFrame
+    {
+      size_type remaining;
+      vector<node_type> slots;
+      size_type size;
+    };
+
+    // The branches are written from an explicit stack rather than by
+    // recursion, so that a deep tree does not exhaust the stack.
+    static void
+    encodeSlots(Encoder& out, data_type const& data)
+    {
+      vector<EncodeFrame> stack{};
+      stack.push_back(EncodeFrame{nullptr, tree_type::slotsOf(data), 0});
+      out.writeVarint(stack.back().slots.size());
+      while (!stack.empty()) {
+        EncodeFrame& frame = stack.back();
+        if (frame.next == frame.slots.size()) {
+          if (frame.branch) {
+            out.remember(*frame.branch);
+          }
+          stack.pop_back();
+          continue;
+        }
+        node_type const* slot = frame.slots[frame.next++];
+        if (holds_alternative<T>(*slot)) {
+          out.writeByte(0);
+          out.encode(get<0>(*slot));
+        } else {
+          out.writeByte(1);
+          branch_pointer const& branch = get<1>(*slot);
+          if (auto id = out.find(branch.get())) {
+            out.writeVarint(*id + 1);
+          } else {
+            out.writeVarint(0);
+            vector<node_type const*> slots = tree_type::slotsOf(branch->data);
+            out.writeVarint(slots.size());
+            stack.push_back(EncodeFrame{&branch, std::move(slots), 0});
+          }
+        }
+      }
+    }
+
+    static DecodeFrame
+    openFrame(Decoder& in)
+    {
+      DecodeFrame frame{in.readCount(), {}, 0};
+      frame.slots.reserve(frame.remaining);
+      return frame;
+    }
+
+    static pair<data_type, size_type>
+    decodeSlots(Decoder& in)
+    {
+      vector<DecodeFrame> stack{};
+      stack.push_back(openFrame(in));
+      while (true) {
+        DecodeFrame& frame = stack.back();
+        if (frame.remaining == 0) {
+          data_type data(frame.slots);
+          size_type size = frame.size;
+          stack.pop_back();
+          if (stack.empty()) {
+            return pair(data, size);
+          }
+          branch_pointer branch =
+            allocate_shared<const Branch>(in.allocator<Branch>(), data, size);
+          in.remember(branch);
+          stack.back().size += 1 + size;
+          stack.back().slots.emplace_back(in_place_index<1>, branch);
+          continue;
+        }
+        --frame.remaining;
+        unsigned char tag = in.readByte();
+        if (tag == 0) {
+          frame.slots.emplace_back(in_place_index<0>, in.decode<T>());
+          ++frame.size;
+        } else if (tag == 1) {
+          std::uint64_t ref = in.readVarint();
+          if (ref == 0) {
+            stack.push_back(openFrame(in));
+          } else {
+            branch_pointer branch = in.recall<Branch>(ref - 1);
+            frame.size += 1 + branch->size;
+            frame.slots.emplace_back(in_place_index<1>, branch);
+          }
+        } else {
+          throw logic_error("Serialized tree has an invalid slot tag");
+        }
+      }
+    }
+  };
+
+  /**
+   * @brief The pairs of a tree list
+   *
+   * @details A pair is written as a reference: zero for nil, one for a
+   * pair that has not been written yet, followed by its car and its cdr,
+   * or two more than the identifier of a pair that has been written.
+   * The car and cdr are each written as a tag, zero for a value followed
+   * by the value, or one for a pair followed by its reference.
+   */
+  template<typename T>
+  struct Serializer<Construct<T>>
+  {
+    using construct_type = Construct<T>;
+    using Kernel = typename construct_type::Kernel;
+    using kernel_pointer = typename construct_type::kernel_pointer;
+    using Slot = typename construct_type::Slot;
+
+    // The pairs are written and read from an explicit stack of the lists
+    // being walked rather than by recursion, so that neither a long list
+    // nor a deep nesting of cars exhausts the stack.
+    static void
+    encode(Encoder& out, construct_type const& xs)
+    {
+      vector<EncodeFrame> stack{};
+      stack.push_back(EncodeFrame{&xs.ptr, {}});
+      while (!stack.empty()) {
+        EncodeFrame& frame = stack.back();
+        kernel_pointer const& p = *frame.next;
+        bool done = true;
+        if (!p) {
+          out.writeVarint(0);
+        } else if (auto id = out.find(p.get())) {
+          out.writeVarint(*id + 2);
+        } else {
+          out.writeVarint(1);
+          frame.fresh.push_back(frame.next);
+          Slot const& car = p->car;
+          if (holds_alternative<construct_type>(car)) {
+            out.writeByte(1);
+            stack.push_back(EncodeFrame{&get<construct_type>(car).ptr, {}});
+            continue;
+          }
+          out.writeByte(0);
+          out.encode(get<Shared<T>>(car));
+          done = encodeCdr(out, frame);
+        }
+        while (done) {
+          vector<kernel_pointer const*>& fresh = stack.back().fresh;
+          for (auto q = fresh.rbegin(); q != fresh.rend(); ++q) {
+            out.remember(**q);
+          }
+          stack.pop_back();
+          if (stack.empty()) {
+            break;
+          }
+          done = encodeCdr(out, stack.back());
+        }
+      }
+    }
+
+    static construct_type
+    decode(Decoder& in)
+    {
+      vector<DecodeFrame> stack(1);
+      std::uint64_t ref = in.readVarint();
+      while (true) {
+        DecodeFrame& frame = stack.back();
+        if (ref == 1) {
+          switch (in.readByte()) {
+            case 0:
+              frame.cars.push_back(Slot(in.decode<Shared<T>>()));
+              break;
+            case 1:
+              stack.emplace_back();
+              ref = in.readVarint();
+              continue;
+            default:
+              throw logic_error("Serialized tree list has an invalid slot tag");
+          }
+          ref = decodeCdr(in, frame);
+          continue;
+        }
+        construct_type result = build(in, frame, ref);
+        stack.pop_back();
+        if (stack.empty()) {
+          return result;
+        }
+        stack.back().cars.push_back(Slot(std::move(result)));
+        ref = decodeCdr(in, stack.back());
+      }
+    }
+
+  private:
+    // A list being written: the reference to write next, and the pairs
+    // written so far, which are remembered once the list is complete.
+    struct EncodeFrame
+    {
+      kernel_pointer const* next;
+      vector<kernel_pointer const*> fresh;
+    };
+
+    // A list being read: the cars read so far, and the value ending it,
+    // if it does not end with a pair or nil.
+    struct DecodeFrame
+    {
+      vector<Slot> cars;
+      optional<Slot> last;
+    };
+
+    // Write the cdr of the last pair written in the frame, returning
+    // whether it completes the list.
+    static bool
+    encodeCdr(Encoder& out, EncodeFrame& frame)
+    {
+      Slot const& cdr = (*frame.fresh.back())->cdr;
+      if (holds_alternative<Shared<T>>(cdr)) {
+        out.writeByte(0);
+        out.encode(get<Shared<T>>(cdr));
+        return true;
+      }
+      out.writeByte(1);
+      frame.next = &get<construct_type>(cdr).ptr;
+      return false;
+    }
+
+    // Read the cdr of the last pair read in the frame, returning the
+    // reference that follows it, or zero if it ends the list.
+    static std::uint64_t
+    decodeCdr(Decoder& in, DecodeFrame& frame)
+    {
+      switch (in.readByte()) {
+        case 0:
+          frame.last.emplace(in.decode<Shared<T>>());
+          return 0;
+        case 1:
+          return in.readVarint();
+        default:
+          throw logic_error("Serialized tree list has an invalid slot tag");
+      }
+    }
+
+    static construct_type
+    build(Decoder& in, DecodeFrame& frame, std::uint64_t ref)
+    {
+      construct_type result{};
+      if (ref > 1) {
+        result.ptr = in.recall<Kernel>(ref - 2);
+      }
+      Slot cdr = frame.last ? std::move(*frame.last) : Slot(result);
+      for (auto car = frame.cars.rbegin(); car != frame.cars.rend(); ++car) {
+        result.ptr = allocate_shared<const Kernel>(
+          in.allocator<Kernel>(), std::move(*car), std::move(cdr));
+        in.remember(result.ptr);
+        cdr = Slot(result);
+      }
+      return result;
+    }
+  };
+
+  /**
+   * @brief Return the binary form of the input value, with the nodes it
+   * shares written once.
+   */
+  template<typename T>
+  string
+  serialize(T const& x)
+  {
+    Encoder out{};
+    out.writeByte(serialization_version);
+    out.encode(x);
+    return out.release();
+  }
+
+  /**
+   * @brief Return the value of type `T` with the input binary form
+   *
+   * @details The nodes of the value are allocated from the input arena,
+   * or from an arena of their own.
+   */
+  template<typename T>
+  T
+  deserialize(
+    string_view bytes, shared_ptr<Arena> arena = make_shared<Arena>())
+  {
+    Decoder in(bytes, std::move(arena));
+    if (in.readByte() != serialization_version) {
+      throw logic_error("Serialized data has an unsupported version");
+    }
+    T result = in.decode<T>();
+    if (!in.isAtEnd()) {
+      throw logic_error("Serialized data has trailing bytes");
+    }
+    return result;
+  }
+
+} // end of namespace ListProcessing::Dynamic::Details
@@ -0,0 +1,18 @@
+#pragma once
+
+namespace ListProcessing::Dynamic::Details {
+
+  /**
+   * @brief A class template describing how values of a type are written
+   * to and read from the binary format of `Serialization.hpp`
+   *
+   * @details Specializations provide
+   * `static void encode(Encoder&, T const&)` and
+   * `static T decode(Decoder&)`.  The containers declare every
+   * specialization a friend, so that their nodes can be written once
+   * however many times they are shared, and read back into an arena.
+   */
+  template<typename T>
+  struct Serializer;
+
+} // end of namespace ListProcessing::Dynamic::Details
@@ -10,6 +10,7 @@
 //
 // ... List Processing header files
 //
+#include <list_processing/dynamic/SerializerFwd.hpp>
 #include <list_processing/dynamic/import.hpp>
 
 namespace ListProcessing::Dynamic::Details {
@@ -102,7 +103,7 @@ namespace ListProcessing::Dynamic::Details {
 
       Kernel(Kernel&& input)
         : values(move(input.values))
-        , fillpoint(input.fillpoint)
+        , fillpoint(input.fillpoint.load())
       {}
 
       template<
@@ -112,7 +113,7 @@ namespace ListProcessing::Dynamic::Details {
       Kernel(F f, size_type n, build_tag)
         : fillpoint(n)
       {
-        assert(n < extent);
+        assert(n <= extent);
         for (index_type i = 0; i < n; ++i) {
           values[i] = f(n - i - 1);
         }
@@ -180,7 +181,10 @@ namespace ListProcessing::Dynamic::Details {
 
     private:
       array<value_type, extent> values;
-      index_type fillpoint;
+
+      // Read without the lock by threads holding shorter views of the
+      // values, while `conj` extends them.
+      atomic<index_type> fillpoint;
       mutex mex;
 
     }; // end of class Kernel
@@ -189,6 +193,9 @@ namespace ListProcessing::Dynamic::Details {
     index_type fillpoint;
     bool reversed;
 
+    template<typename U>
+    friend struct Serializer;
+
     ShortList(const_reference x, ShortList xs)
       : data(Kernel::conj(xs.data, xs.fillpoint, x))
       , fillpoint(xs.fillpoint + 1)
@@ -219,6 +226,70 @@ namespace ListProcessing::Dynamic::Details {
     {}
 
   public:
+    /**
+     * @brief Storage for the chunks of a list that are never freed
+     *
+     * @details The values are split into chunks of at most `N` values,
+     * with only the first chunk partially filled, as consing would leave
+     * them.  The short lists viewing the chunks do not own them, and an
+     * instance is intended to have static storage duration.  The chunks
+     * are not constant, because consing onto a partial chunk extends it
+     * in place.
+     */
+    template<size_type Count>
+    class StaticChunks
+    {
+    public:
+      static constexpr size_type size = (Count + N - 1) / N;
+
+      explicit StaticChunks(array<value_type, Count> const& values)
+        : StaticChunks(values, make_index_sequence<size>())
+      {}
+
+      StaticChunks(StaticChunks const&) = delete;
+
+      StaticChunks&
+      operator=(StaticChunks const&) = delete;
+
+      /**
+       * @brief Return short lists viewing the chunks, from the first
+       */
+      array<ShortList, size>
+      chunks()
+      {
+        return [&]<size_t... Ks>(index_sequence<Ks...>) {
+          return array<ShortList, size>{ShortList(
+            shared_ptr<Kernel>(shared_ptr<Kernel>(), &kernels[Ks]),
+            chunkLength(Ks),
+            false)...};
+        }(make_index_sequence<size>());
+      }
+
+    private:
+      static constexpr size_type
+      chunkLength(size_type k)
+      {
+        return k == 0 ? Count - (size - 1) * N : N;
+      }
+
+      static constexpr size_type
+      chunkStart(size_type k)
+      {
+        return k == 0 ? 0 : chunkLength(0) + (k - 1) * N;
+      }
+
+      template<size_t... Ks>
+      StaticChunks(
+        array<value_type, Count> const& values, index_sequence<Ks...>)
+        : kernels{Kernel(
+            [&](index_type i) { return values[chunkStart(Ks) + i]; },
+            chunkLength(Ks),
+            build_tag{})...}
+      {}
+
+      array<Kernel, size> kernels;
+    };
+
     const_reference
     getHead() const
     {
@@ -0,0 +1,719 @@
+#pragma once
+
+//
+// ... Standard header files
+//
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define LIST_PROCESSING_HAS_MMAP 1
+#endif
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/AList.hpp>
+#include <list_processing/dynamic/HashTable.hpp>
+#include <list_processing/dynamic/List.hpp>
+#include <list_processing/dynamic/OrderedMap.hpp>
+#include <list_processing/dynamic/import.hpp>
+
+namespace ListProcessing::Dynamic::Details {
+
+  /**
+   * @brief The kinds of container a snapshot may hold
+   */
+  enum class SnapshotKind : std::uint32_t { list = 1, map = 2 };
+
+  /**
+   * @brief The first bytes of a snapshot
+   *
+   * @details Snapshots are written in the byte order and layout of the
+   * host that writes them.  The header records enough of both, with the
+   * sizes of the stored types, that a snapshot opened by a different
+   * build, or as a container of the wrong type, is rejected rather than
+   * misread.  The contents start at `root`, an offset from the start of
+   * the snapshot.
+   */
+  struct SnapshotHeader
+  {
+    array<char, 8> magic;
+    std::uint32_t byte_order;
+    SnapshotKind kind;
+    std::uint64_t key_size;
+    std::uint64_t value_size;
+    std::uint64_t root;
+    std::uint64_t count;
+  };
+
+  constexpr array<char, 8> snapshot_magic{'L', 'P', 'S', 'N', 'A', 'P', 0, 1};
+  constexpr std::uint32_t snapshot_byte_order = 0x01020304;
+
+  constexpr std::uint64_t
+  alignedOffset(std::uint64_t offset, std::uint64_t alignment)
+  {
+    return (offset + alignment - 1) / alignment * alignment;
+  }
+
+  /**
+   * @brief The bytes of a snapshot, either held in memory or mapped from a
+   * file
+   *
+   * @details Copies share the bytes, which are released, or unmapped,
+   * with the last copy.  A file is mapped read only and shared, so the
+   * pages of a snapshot opened by several processes are loaded once and
+   * only when they are read.
+   */
+  class SnapshotBytes
+  {
+  public:
+    SnapshotBytes() = default;
+
+    /**
+     * @brief Return the bytes of a snapshot held in memory
+     */
+    static SnapshotBytes
+    copyOf(string_view bytes)
+    {
+      // Stored values are read in place, so the copy is maximally aligned.
+      size_type n = alignedOffset(bytes.size(), sizeof(std::max_align_t)) /
+                    sizeof(std::max_align_t);
+      shared_ptr<std::max_align_t[]> storage(new std::max_align_t[n]);
+      std::memcpy(storage.get(), bytes.data(), bytes.size());
+      return SnapshotBytes(
+        shared_ptr<char const>(
+          storage, reinterpret_cast<char const*>(storage.get())),
+        bytes.size());
+    }
+
+    /**
+     * @brief Return the bytes of the snapshot in the named file
+     */
+    static SnapshotBytes
+    open(string const& path)
+    {
+#ifdef LIST_PROCESSING_HAS_MMAP
+      int fd = ::open(path.c_str(), O_RDONLY);
+      if (fd < 0) {
+        throw logic_error("Unable to open snapshot " + path);
+      }
+      struct stat status{};
+      if (::fstat(fd, &status) != 0 || status.st_size == 0) {
+        ::close(fd);
+        throw logic_error("Unable to map snapshot " + path);
+      }
+      size_type size = status.st_size;
+      void* address = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+      ::close(fd);
+      if (address == MAP_FAILED) {
+        throw logic_error("Unable to map snapshot " + path);
+      }
+      return SnapshotBytes(
+        shared_ptr<char const>(
+          static_cast<char const*>(address),
+          [size](char const* p) { ::munmap(const_cast<char*>(p), size); }),
+        size);
+#else
+      std::ifstream file(path, std::ios::binary);
+      if (!file) {
+        throw logic_error("Unable to open snapshot " + path);
+      }
+      string bytes(
+        (std::istreambuf_iterator<char>(file)),
+        std::istreambuf_iterator<char>());
+      return copyOf(bytes);
+#endif
+    }
+
+    char const*
+    data() const
+    {
+      return base.get();
+    }
+
+    size_type
+    size() const
+    {
+      return length;
+    }
+
+    /**
+     * @brief Return the header of the snapshot, after checking that it
+     * holds a container of the input kind, with elements of the input
+     * alignment and keys and values of the input sizes.
+     */
+    SnapshotHeader
+    header(
+      SnapshotKind kind,
+      size_t alignment,
+      size_t key_size,
+      size_t value_size) const
+    {
+      SnapshotHeader result{};
+      if (size_type(sizeof(result)) > length) {
+        throw logic_error("Snapshot is truncated");
+      }
+      std::memcpy(&result, base.get(), sizeof(result));
+      if (result.magic != snapshot_magic) {
+        throw logic_error("Data is not a snapshot");
+      }
+      if (result.byte_order != snapshot_byte_order) {
+        throw logic_error("Snapshot was written with another byte order");
+      }
+      if (
+        result.kind != kind || result.key_size != key_size ||
+        result.value_size != value_size) {
+        throw logic_error("Snapshot holds a container of another type");
+      }
+      if (
+        result.root % alignment != 0 || result.root > std::uint64_t(length) ||
+        result.count > (length - result.root) / (key_size + value_size)) {
+        throw logic_error("Snapshot is truncated");
+      }
+      return result;
+    }
+
+  private:
+    SnapshotBytes(shared_ptr<char const> base, size_type length)
+      : base(std::move(base))
+      , length(length)
+    {}
+
+    shared_ptr<char const> base{};
+    size_type length{0};
+  };
+
+  /**
+   * @brief Return the bytes of a snapshot with the input header, followed
+   * by the input elements, stored contiguously
+   */
+  template<typename E>
+  string
+  snapshotOf(SnapshotHeader header, vector<E> const& elements)
+  {
+    header.magic = snapshot_magic;
+    header.byte_order = snapshot_byte_order;
+    header.root = alignedOffset(sizeof(SnapshotHeader), alignof(E));
+    header.count = elements.size();
+    string result(header.root + elements.size() * sizeof(E), '\0');
+    std::memcpy(result.data(), &header, sizeof(header));
+    if (!elements.empty()) {
+      std::memcpy(
+        result.data() + header.root,
+        elements.data(),
+        elements.size() * sizeof(E));
+    }
+    return result;
+  }
+
+  /**
+   * @brief Write the bytes of a snapshot to the named file
+   *
+   * @details The bytes are written to a new file in the same directory,
+   * which is then renamed over the named file.  A snapshot file is thus
+   * replaced, never rewritten in place, so processes that have the old
+   * file mapped keep reading the old snapshot.
+   */
+  inline void
+  writeSnapshot(string const& path, string_view bytes)
+  {
+    string temporary = path + ".tmp" + std::to_string(std::random_device{}());
+    std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+    file.write(bytes.data(), bytes.size());
+    file.close();
+    std::error_code error{};
+    if (file) {
+      std::filesystem::rename(temporary, path, error);
+    }
+    if (!file || error) {
+      std::filesystem::remove(temporary, error);
+      throw logic_error("Unable to write snapshot " + path);
+    }
+  }
+
+  /**
+   * @brief A read only list whose values are stored in a snapshot
+   *
+   * @details The values are stored contiguously, in the order of the
+   * list, and read in place: `head` returns a reference into the
+   * snapshot, and `tail` only advances a pointer.  The value type must be
+   * trivially copyable.
+   */
+  template<typename T>
+  class SnapshotList
+  {
+    static_assert(
+      std::is_trivially_copyable_v<T>,
+      "SnapshotList requires a trivially copyable value type");
+
+  public:
+    using value_type = T;
+    using const_reference = value_type const&;
+
+    SnapshotList() = default;
+
+    explicit SnapshotList(SnapshotBytes input_bytes)
+      : bytes(std::move(input_bytes))
+    {
+      SnapshotHeader header =
+        bytes.header(
+          SnapshotKind::list, alignof(value_type), 0, sizeof(value_type));
+      first =
+        reinterpret_cast<value_type const*>(bytes.data() + header.root);
+      count = header.count;
+    }
+
+    /**
+     * @brief Return a list with the values stored in the named file
+     */
+    static SnapshotList
+    open(string const& path)
+    {
+      return SnapshotList(SnapshotBytes::open(path));
+    }
+
+    bool
+    isEmpty() const
+    {
+      return count == 0;
+    }
+
+    friend bool
+    isEmpty(SnapshotList const& xs)
+    {
+      return xs.isEmpty();
+    }
+
+    bool
+    hasData() const
+    {
+      return count > 0;
+    }
+
+    friend bool
+    hasData(SnapshotList const& xs)
+    {
+      return xs.hasData();
+    }
+
+    const_reference
+    head() const
+    {
+      if (isEmpty()) {
+        throw logic_error("Cannot access the head of an empty list");
+      }
+      return *first;
+    }
+
+    friend const_reference
+    head(SnapshotList const& xs)
+    {
+      return xs.head();
+    }
+
+    SnapshotList
+    tail() const
+    {
+      return isEmpty() ? *this : SnapshotList(bytes, first + 1, count - 1);
+    }
+
+    friend SnapshotList
+    tail(SnapshotList const& xs)
+    {
+      return xs.tail();
+    }
+
+    size_type
+    length() const
+    {
+      return count;
+    }
+
+    friend size_type
+    length(SnapshotList const& xs)
+    {
+      return xs.length();
+    }
+
+    const_reference
+    listRef(index_type index) const
+    {
+      if (index < 0 || index >= count) {
+        throw logic_error("SnapshotList index out of range");
+      }
+      return first[index];
+    }
+
+    friend const_reference
+    listRef(SnapshotList const& xs, index_type index)
+    {
+      return xs.listRef(index);
+    }
+
+    /**
+     * @brief Apply the binary input function to the input list,
+     * folding from the left.
+     */
+    template<typename F, typename U>
+    friend U
+    foldL(F f, U init, SnapshotList const& xs)
+    {
+      for (index_type i = 0; i < xs.count; ++i) {
+        init = f(init, xs.first[i]);
+      }
+      return init;
+    }
+
+    template<typename F>
+    friend void
+    doList(SnapshotList const& xs, F f)
+    {
+      for (index_type i = 0; i < xs.count; ++i) {
+        f(xs.first[i]);
+      }
+    }
+
+    /**
+     * @brief Return a dynamic list with the values of this list
+     */
+    ListType<value_type>
+    toList() const
+    {
+      ListType<value_type> result{};
+      for (index_type i = count; i > 0; --i) {
+        result = cons(first[i - 1], result);
+      }
+      return result;
+    }
+
+    friend ListType<value_type>
+    toList(SnapshotList const& xs)
+    {
+      return xs.toList();
+    }
+
+  private:
+    SnapshotList(
+      SnapshotBytes bytes, value_type const* first, size_type count)
+      : bytes(std::move(bytes))
+      , first(first)
+      , count(count)
+    {}
+
+    SnapshotBytes bytes{};
+    value_type const* first{nullptr};
+    size_type count{0};
+  };
+
+  /**
+   * @brief Return the bytes of a snapshot of the input list
+   */
+  template<typename T, size_type N>
+  string
+  listSnapshot(List<T, N> const& xs)
+  {
+    static_assert(
+      std::is_trivially_copyable_v<T>,
+      "listSnapshot requires a trivially copyable value type");
+    vector<T> values{};
+    doList(xs, [&](T const& x) { values.push_back(x); });
+    SnapshotHeader header{};
+    header.kind = SnapshotKind::list;
+    header.value_size = sizeof(T);
+    return snapshotOf(header, values);
+  }
+
+  /**
+   * @brief An association stored in a snapshot
+   */
+  template<typename K, typename T>
+  struct SnapshotEntry
+  {
+    K key;
+    T value;
+  };
+
+  /**
+   * @brief A read only map whose associations are stored in a snapshot
+   *
+   * @details The associations are stored contiguously, in the order of
+   * their keys, and found by binary search, in place.  The key and value
+   * types must be trivially copyable.
+   */
+  template<typename K, typename T, typename Cmp = std::less<K>>
+  class SnapshotMap
+  {
+    static_assert(
+      std::is_trivially_copyable_v<K> && std::is_trivially_copyable_v<T>,
+      "SnapshotMap requires trivially copyable key and value types");
+
+  public:
+    using key_type = K;
+    using mapped_type = T;
+    using entry_type = SnapshotEntry<K, T>;
+
+    SnapshotMap() = default;
+
+    explicit SnapshotMap(SnapshotBytes input_bytes)
+      : bytes(std::move(input_bytes))
+    {
+      SnapshotHeader header = bytes.header(
+        SnapshotKind::map,
+        alignof(entry_type),
+        sizeof(K),
+        sizeof(entry_type) - sizeof(K));
+      first = reinterpret_cast<entry_type const*>(bytes.data() + header.root);
+      count = header.count;
+    }
+
+    /**
+     * @brief Return a map with the associations stored in the named file
+     */
+    static SnapshotMap
+    open(string const& path)
+    {
+      return SnapshotMap(SnapshotBytes::open(path));
+    }
+
+  private:
+    entry_type const*
+    find(K const& key) const
+    {
+      entry_type const* last = first + count;
+      entry_type const* p = std::partition_point(
+        first, last, [&](entry_type const& x) { return Cmp{}(x.key, key); });
+      return p != last && !Cmp{}(key, p->key) ? p : nullptr;
+    }
+
+    /**
+     * @brief Return a dynamic list of the results of applying the input
+     * function to the associations of this map, in the order of the keys.
+     */
+    template<typename F>
+    auto
+    listOf(F f) const
+    {
+      using U = decay_t<invoke_result_t<F, entry_type const&>>;
+      ListType<U> result{};
+      for (index_type i = count; i > 0; --i) {
+        result = cons(U(f(first[i - 1])), result);
+      }
+      return result;
+    }
+
+  public:
+    bool
+    hasKey(K const& key) const
+    {
+      return find(key) != nullptr;
+    }
+
+    friend bool
+    hasKey(K const& key, SnapshotMap const& xs)
+    {
+      return xs.hasKey(key);
+    }
+
+    T
+    forceGet(K const& key, T const& alternate) const
+    {
+      entry_type const* p = find(key);
+      return p ? p->value : alternate;
+    }
+
+    friend T
+    forceGet(K const& key, T const& alternate, SnapshotMap const& xs)
+    {
+      return xs.forceGet(key, alternate);
+    }
+
+    optional<T>
+    maybeGet(K const& key) const
+    {
+      entry_type const* p = find(key);
+      return p ? optional<T>(p->value) : nullopt;
+    }
+
+    friend optional<T>
+    maybeGet(K const& key, SnapshotMap const& xs)
+    {
+      return xs.maybeGet(key);
+    }
+
+    T const&
+    tryGet(K const& key) const
+    {
+      entry_type const* p = find(key);
+      if (!p) {
+        throw logic_error("SnapshotMap does not have requested key!");
+      }
+      return p->value;
+    }
+
+    friend T const&
+    tryGet(K const& key, SnapshotMap const& xs)
+    {
+      return xs.tryGet(key);
+    }
+
+    bool
+    isEmpty() const
+    {
+      return count == 0;
+    }
+
+    friend bool
+    isEmpty(SnapshotMap const& xs)
+    {
+      return xs.isEmpty();
+    }
+
+    size_type
+    length() const
+    {
+      return count;
+    }
+
+    friend size_type
+    length(SnapshotMap const& xs)
+    {
+      return xs.length();
+    }
+
+    /**
+     * @brief Return the keys of this map, in order
+     */
+    ListType<K>
+    keys() const
+    {
+      return listOf([](entry_type const& x) { return x.key; });
+    }
+
+    friend ListType<K>
+    keys(SnapshotMap const& xs)
+    {
+      return xs.keys();
+    }
+
+    /**
+     * @brief Return the values of this map, in the order of their keys
+     */
+    ListType<T>
+    vals() const
+    {
+      return listOf([](entry_type const& x) { return x.value; });
+    }
+
+    friend ListType<T>
+    vals(SnapshotMap const& xs)
+    {
+      return xs.vals();
+    }
+
+    /**
+     * @brief Return the associations of this map, in the order of their
+     * keys
+     */
+    ListType<pair<K, T>>
+    toList() const
+    {
+      return listOf(
+        [](entry_type const& x) { return pair<K, T>(x.key, x.value); });
+    }
+
+    friend ListType<pair<K, T>>
+    toList(SnapshotMap const& xs)
+    {
+      return xs.toList();
+    }
+
+    /**
+     * @brief Call a function with each association of the input map, by
+     * reference, in the order of the keys.
+     */
+    template<typename F>
+    friend F
+    doEntries(SnapshotMap const& xs, F f)
+    {
+      for (index_type i = 0; i < xs.count; ++i) {
+        f(xs.first[i]);
+      }
+      return f;
+    }
+
+  private:
+    SnapshotBytes bytes{};
+    entry_type const* first{nullptr};
+    size_type count{0};
+  };
+
+  /**
+   * @brief Return the bytes of a snapshot of the associations visited by
+   * the input function, keeping the first association with each key.
+   */
+  template<typename K, typename T, typename Cmp, typename F>
+  string
+  mapSnapshotOf(F visit)
+  {
+    static_assert(
+      std::is_trivially_copyable_v<K> && std::is_trivially_copyable_v<T>,
+      "mapSnapshot requires trivially copyable key and value types");
+    using entry_type = SnapshotEntry<K, T>;
+    vector<entry_type> entries{};
+    visit([&](pair<K, T> const& x) {
+      entries.push_back(entry_type{x.first, x.second});
+    });
+    auto less = [](entry_type const& x, entry_type const& y) {
+      return Cmp{}(x.key, y.key);
+    };
+    std::stable_sort(entries.begin(), entries.end(), less);
+    entries.erase(
+      std::unique(
+        entries.begin(),
+        entries.end(),
+        [&](entry_type const& x, entry_type const& y) {
+          return !less(x, y) && !less(y, x);
+        }),
+      entries.end());
+    SnapshotHeader header{};
+    header.kind = SnapshotKind::map;
+    header.key_size = sizeof(K);
+    header.value_size = sizeof(entry_type) - sizeof(K);
+    return snapshotOf(header, entries);
+  }
+
+  /**
+   * @brief Return the bytes of a snapshot of the input alist, with the
+   * newest association with each key.
+   */
+  template<typename K, typename T>
+  string
+  mapSnapshot(AList<K, T> const& xs)
+  {
+    return mapSnapshotOf<K, T, std::less<K>>(
+      [&](auto f) { doList(xs.toList(), f); });
+  }
+
+  template<typename K, typename T, typename Cmp>
+  string
+  mapSnapshot(OrderedMap<K, T, Cmp> const& xs)
+  {
+    return mapSnapshotOf<K, T, Cmp>([&](auto f) { doEntries(xs, f); });
+  }
+
+  template<typename K, typename T, size_type B>
+  string
+  mapSnapshot(HashTable<K, T, B> const& xs)
+  {
+    return mapSnapshotOf<K, T, std::less<K>>(
+      [&](auto f) { doEntries(xs, f); });
+  }
+
+} // end of namespace ListProcessing::Dynamic::Details
@@ -0,0 +1,246 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/List.hpp>
+#include <list_processing/dynamic/Parallel.hpp>
+#include <list_processing/dynamic/ThreadPool.hpp>
+#include <list_processing/dynamic/import.hpp>
+
+namespace ListProcessing::Dynamic::Details {
+
+  /**
+   * @brief The minimum number of elements for which the radix sort is
+   * preferred to the merge sort.
+   */
+  constexpr size_type radix_sort_threshold = 256;
+
+  /**
+   * @brief True when the elements can be sorted by value with a radix sort
+   * instead of through the comparison.
+   */
+  template<typename T, typename Cmp>
+  constexpr bool is_radix_sortable_v =
+    is_integral_v<T> && !is_same_v<T, bool> &&
+    (is_same_v<Cmp, std::less<T>> || is_same_v<Cmp, std::less<>>);
+
+  /**
+   * @brief Stably sort a range with a natural merge sort.
+   *
+   * @details Maximal non-descending runs are kept, and strictly descending
+   * runs are reversed, before the runs are merged bottom up.  An input
+   * that is already sorted costs a single pass.
+   */
+  template<typename It, typename Less>
+  void
+  naturalMergeSort(It first, It last, Less less) {
+    size_type n = last - first;
+    if (n < 2) {
+      return;
+    }
+
+    vector<index_type> bounds{0};
+    for (index_type i = 0; i < n;) {
+      index_type j = i + 1;
+      if (j < n && less(first[j], first[j - 1])) {
+        while (j < n && less(first[j], first[j - 1])) {
+          ++j;
+        }
+        std::reverse(first + i, first + j);
+      } else {
+        while (j < n && !less(first[j], first[j - 1])) {
+          ++j;
+        }
+      }
+      bounds.push_back(j);
+      i = j;
+    }
+
+    while (bounds.size() > 2) {
+      vector<index_type> merged{0};
+      for (size_type k = 0; k + 1 < size_type(bounds.size()); k += 2) {
+        if (k + 2 < size_type(bounds.size())) {
+          std::inplace_merge(
+            first + bounds[k],
+            first + bounds[k + 1],
+            first + bounds[k + 2],
+            less);
+          merged.push_back(bounds[k + 2]);
+        } else {
+          merged.push_back(bounds[k + 1]);
+        }
+      }
+      bounds = std::move(merged);
+    }
+  }
+
+  /**
+   * @brief Stably sort a range in parallel.
+   *
+   * @details Blocks of at least `grain` elements are sorted by separate
+   * tasks, then adjacent blocks are merged pairwise, in parallel, until one
+   * block remains.
+   */
+  template<typename It, typename Less>
+  void
+  parallelNaturalMergeSort(It first, It last, Less less, size_type grain) {
+    size_type n = last - first;
+    size_type block = std::max(grain, size_type(1));
+    size_type block_count = (n + block - 1) / block;
+    if (block_count < 2) {
+      naturalMergeSort(first, last, less);
+      return;
+    }
+
+    ThreadPool& pool = ThreadPool::global();
+    pool.parallelFor(block_count, [&](index_type k) {
+      naturalMergeSort(
+        first + k * block, first + std::min((k + 1) * block, n), less);
+    });
+
+    for (size_type width = block; width < n; width *= 2) {
+      size_type pair_count = (n + 2 * width - 1) / (2 * width);
+      pool.parallelFor(pair_count, [&](index_type k) {
+        index_type start = k * 2 * width;
+        index_type middle = std::min(start + width, n);
+        index_type stop = std::min(start + 2 * width, n);
+        std::inplace_merge(first + start, first + middle, first + stop, less);
+      });
+    }
+  }
+
+  /**
+   * @brief Sort integers in ascending order with an LSD radix sort.
+   *
+   * @details Passes over bytes on which every key agrees are skipped.
+   */
+  template<typename T>
+  void
+  radixSort(vector<T>& xs) {
+    using Key = make_unsigned_t<T>;
+    constexpr Key flip =
+      is_signed_v<T> ? Key(Key(1) << (8 * sizeof(T) - 1)) : Key(0);
+    constexpr int digit_bits = 8;
+    constexpr size_type radix = size_type(1) << digit_bits;
+    size_type n = size_type(xs.size());
+
+    vector<T> buffer(n);
+    for (size_type shift = 0; shift < size_type(8 * sizeof(T));
+         shift += digit_bits) {
+      auto digit = [=](T x) {
+        return size_type(((Key(x) ^ flip) >> shift) & Key(radix - 1));
+      };
+
+      array<size_type, radix> counts{};
+      for (T x : xs) {
+        ++counts[digit(x)];
+      }
+      if (counts[digit(xs.front())] == n) {
+        continue;
+      }
+
+      size_type total = 0;
+      for (size_type& count : counts) {
+        size_type c = count;
+        count = total;
+        total += c;
+      }
+      for (T x : xs) {
+        buffer[counts[digit(x)]++] = x;
+      }
+      xs.swap(buffer);
+    }
+  }
+
+  /**
+   * @brief Return a list with the elements of the input list stably sorted
+   * by the input comparison.
+   *
+   * @details The longest suffix of the input that is already in its final
+   * position is shared with the result instead of being rebuilt, so a
+   * sorted input is returned as is.  The remaining elements are sorted with
+   * a natural merge sort or, for integers in ascending order, a radix sort.
+   * When `parallel` is true, the sort and the construction of the result
+   * run on the global `ThreadPool`.
+   */
+  template<typename Cmp, typename T, size_type N>
+  List<T, N>
+  sortListAux(Cmp cmp, List<T, N> const& xs, bool parallel, size_type grain) {
+    vector<T const*> items{};
+    doList(xs, [&](T const& x) { items.push_back(&x); });
+    size_type n = size_type(items.size());
+
+    index_type sorted = n == 0 ? 0 : n - 1;
+    while (sorted > 0 && !cmp(*items[sorted], *items[sorted - 1])) {
+      --sorted;
+    }
+    if (sorted == 0) {
+      return xs;
+    }
+
+    T const* greatest = items[0];
+    for (index_type i = 1; i < sorted; ++i) {
+      if (cmp(*greatest, *items[i])) {
+        greatest = items[i];
+      }
+    }
+    while (sorted < n && cmp(*items[sorted], *greatest)) {
+      ++sorted;
+    }
+
+    auto build = [&](auto at) {
+      if (parallel && sorted == n) {
+        return assembleList<T, N>(n, at, grain);
+      }
+      List<T, N> result = sorted == n ? List<T, N>{} : drop(xs, sorted);
+      for (index_type i = sorted - 1; i >= 0; --i) {
+        result = cons(at(i), result);
+      }
+      return result;
+    };
+
+    if constexpr (is_radix_sortable_v<T, Cmp>) {
+      if (sorted >= radix_sort_threshold) {
+        vector<T> values(sorted);
+        for (index_type i = 0; i < sorted; ++i) {
+          values[i] = *items[i];
+        }
+        radixSort(values);
+        return build([&](index_type i) { return values[i]; });
+      }
+    }
+
+    auto less = [&](T const* x, T const* y) { return cmp(*x, *y); };
+    if (parallel) {
+      parallelNaturalMergeSort(
+        items.begin(), items.begin() + sorted, less, grain);
+    } else {
+      naturalMergeSort(items.begin(), items.begin() + sorted, less);
+    }
+    return build([&](index_type i) -> T const& { return *items[i]; });
+  }
+
+  /**
+   * @brief Return a list with the elements of the input list stably sorted
+   * by the input comparison.
+   */
+  template<typename Cmp, typename T, size_type N>
+  List<T, N>
+  sortList(Cmp cmp, List<T, N> const& xs) {
+    return sortListAux(cmp, xs, false, default_grain_size);
+  }
+
+  /**
+   * @brief Return a list with the elements of the input list stably sorted
+   * by the input comparison, sorting blocks of at least `grain` elements
+   * in parallel.
+   */
+  template<typename Cmp, typename T, size_type N>
+  List<T, N>
+  parallelSortList(
+    Cmp cmp, List<T, N> const& xs, size_type grain = default_grain_size) {
+    return sortListAux(cmp, xs, true, grain);
+  }
+
+} // end of namespace ListProcessing::Dynamic::Details
@@ -19,8 +19,8 @@ namespace ListProcessing::Dynamic::Details {
     using reference = value_type&;
     using const_reference = value_type const&;
 
-    Stack()
-      : data(nil<value_type>) {}
+    constexpr Stack()
+      : data() {}
 
   private:
     using data_type = List<value_type>;
@@ -30,6 +30,9 @@ namespace ListProcessing::Dynamic::Details {
 
     data_type data;
 
+    template<typename U>
+    friend struct Serializer;
+
     //               _
     //  _ __ _  _ __| |_
     // | '_ \ || (_-< ' \.
@@ -428,6 +431,6 @@ namespace ListProcessing::Dynamic::Details {
   }; // end of class Stack
 
   template<typename T>
-  const Stack<T> empty_stack{};
+  constinit const Stack<T> empty_stack{};
 
 } // end of namespace ListProcessing::Dynamic::Details
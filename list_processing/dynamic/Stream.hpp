@@ -16,8 +16,10 @@ namespace ListProcessing::Dynamic::Details {
     using Thunk = function<Stream()>;
 
   public:
+    using value_type = T;
+
     Stream()
-      : pkernel_{make_shared<Kernel>()} {}
+      : pkernel_{kernel_pointer(), &empty_kernel} {}
 
     template<convertible_to<Thunk> F>
     explicit Stream(F&& thunk)
@@ -56,9 +58,7 @@ namespace ListProcessing::Dynamic::Details {
     size_type
     length() const {
       size_type count = 0;
-      unique_ptr<Stream> ptr = std::make_unique<Stream>(*this);
-      while (ptr->hasData()) {
-        ptr = std::make_unique<Stream>(ptr->tail());
+      for (Kernel const* p = pkernel_.get(); p->hasData(); p = p->next()) {
         ++count;
       }
       return count;
@@ -69,13 +69,17 @@ namespace ListProcessing::Dynamic::Details {
       return xs.length();
     }
 
-    Head
+    /**
+     * @brief Return the head of this stream, by reference to the value
+     * held by the stream, which lives as long as the stream does.
+     */
+    Head const&
     head() const {
       return pkernel_->head();
     }
 
-    friend Head
-    head(Stream xs) {
+    friend Head const&
+    head(Stream const& xs) {
       return xs.head();
     }
 
@@ -84,22 +88,22 @@ namespace ListProcessing::Dynamic::Details {
       return pkernel_->tail();
     }
 
-    Head
+    Head const&
     streamRef(size_type index) const {
-      unique_ptr<Stream> ptr = std::make_unique<Stream>(*this);
+      Kernel const* p = pkernel_.get();
       while (index > 0) {
-        ptr = make_unique<Stream>(ptr->tail());
+        p = p->hasData() ? p->next() : p;
         --index;
       }
-      return ptr->head();
+      return p->head();
     }
 
-    friend Head
-    streamRef(size_type index, Stream xs) {
+    friend Head const&
+    streamRef(size_type index, Stream const& xs) {
       return xs.streamRef(index);
     }
 
-    Head
+    Head const&
     operator[](size_type index) const {
       return streamRef(index);
     }
@@ -186,20 +190,82 @@ namespace ListProcessing::Dynamic::Details {
 
     auto
     toList() const {
-      unique_ptr<Stream> pstream = make_unique<Stream>(*this);
-      unique_ptr<List<T>> plist = make_unique<List<T>>();
-      while (pstream->hasData()) {
-        plist = make_unique<List<T>>(listCons(*(pstream->head()), *plist));
-        pstream = make_unique<Stream>(pstream->tail());
+      List<T> accum{};
+      for (Kernel const* p = pkernel_.get(); p->hasData(); p = p->next()) {
+        accum = listCons(*(p->head()), accum);
+      }
+      return reverse(accum);
+    }
+
+    /**
+     * @brief Return an association list from each key returned by the
+     * input function to the elements with that key.
+     */
+    template<typename F>
+    auto
+    groupBy(F key) const {
+      return hashGroupBy(key, *this);
+    }
+
+    /**
+     * @brief Return an association list from each key returned by the
+     * input function to the number of elements with that key.
+     */
+    template<typename F>
+    auto
+    countBy(F key) const {
+      return hashCountBy(key, *this);
+    }
+
+    /**
+     * @brief Return the first occurrences of the elements, in order.
+     */
+    auto
+    distinct() const {
+      return hashDistinct(*this);
+    }
+
+    /**
+     * @brief Return the pairs of elements of this stream and the input
+     * collection that have equal keys.
+     */
+    template<typename F, typename Ys>
+    auto
+    innerJoin(F key, Ys const& ys) const {
+      return hashInnerJoin(key, *this, ys);
+    }
+
+    /**
+     * @brief Return the pairs of elements of this stream and the input
+     * collection that have equal keys, keeping unmatched elements of this
+     * stream.
+     */
+    template<typename F, typename Ys>
+    auto
+    leftJoin(F key, Ys const& ys) const {
+      return hashLeftJoin(key, *this, ys);
+    }
+
+    /**
+     * @brief Call a function with each element of an input stream,
+     * forcing the stream as it goes.
+     *
+     * @details The elements are passed by reference and remain valid for
+     * as long as the input stream.
+     */
+    template<typename F>
+    friend F
+    doStream(Stream const& xs, F f) {
+      for (Kernel const* p = xs.pkernel_.get(); p->hasData(); p = p->next()) {
+        f(*p->headRef());
       }
-      return reverse(*plist);
+      return f;
     }
 
     void
     pull() const {
-      std::unique_ptr<Stream> ptr = make_unique<Stream>(*this);
-      while (ptr->hasData()) {
-        ptr = make_unique<Stream>(ptr->tail());
+      for (Kernel const* p = pkernel_.get(); p->hasData(); p = p->next()) {
+        // Each call to hasData forces the cell it is asked about.
       }
     }
 
@@ -212,7 +278,7 @@ namespace ListProcessing::Dynamic::Details {
         : head_{head}
         , tail_{tail} {}
 
-      Head
+      Head const&
       head() const {
         return head_;
       }
@@ -281,7 +347,7 @@ namespace ListProcessing::Dynamic::Details {
         return !hasData();
       }
 
-      Head
+      Head const&
       head() const {
         return hasData() ? get<Cell>(*pdata_).head()
                          : throw logic_error(
@@ -293,6 +359,24 @@ namespace ListProcessing::Dynamic::Details {
         return hasData() ? get<Cell>(*pdata_).tail() : Stream{};
       }
 
+      Head const&
+      headRef() const {
+        assert(hasData());
+        return get<Cell>(*pdata_).head_;
+      }
+
+      /**
+       * @brief Return the kernel of the tail of a stream that has data.
+       *
+       * @details The tail kernel is owned by this one, so walking a stream
+       * through these pointers does not touch any reference count.
+       */
+      Kernel const*
+      next() const {
+        assert(hasData());
+        return get<Cell>(*pdata_).tail_.pkernel_.get();
+      }
+
     private:
       void
       reify() const {
@@ -301,12 +385,26 @@ namespace ListProcessing::Dynamic::Details {
           lock_guard lock{*pmex_};
           while (lazy()) {
             Stream xs = get<Thunk>(*pdata_)();
-            pdata_ = std::move(xs.pkernel_->pdata_);
+            if (xs.pkernel_.use_count() == 1) {
+              pdata_ = std::move(xs.pkernel_->pdata_);
+            } else {
+              // The kernel is shared with streams held elsewhere, so its
+              // data is forced and copied rather than stolen from them.
+              pdata_ = xs.hasData()
+                         ? std::make_unique<data_type>(*xs.pkernel_->pdata_)
+                         : nullptr;
+            }
           }
         }
       }
     };
 
+    // The kernel of every empty stream that is not lazy.  It is
+    // constant-initialized and referred to without a control block, so
+    // default-constructing a stream neither allocates nor counts
+    // references.
+    inline static constinit Kernel const empty_kernel{};
+
     using kernel_pointer = shared_ptr<const Kernel>;
     kernel_pointer pkernel_{nullptr};
   };
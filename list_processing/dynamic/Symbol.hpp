@@ -0,0 +1,224 @@
+#pragma once
+
+//
+// ... Standard header files
+//
+#include <compare>
+#include <shared_mutex>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/import.hpp>
+
+namespace ListProcessing::Dynamic::Details {
+
+  class SymbolTable;
+
+  /**
+   * @brief The interned text of a symbol, with its hash
+   */
+  struct SymbolName
+  {
+    std::uint64_t hash;
+    string text;
+  };
+
+  /**
+   * @brief An interned string
+   *
+   * @details A symbol is a pointer to the single copy of its text held
+   * by a `SymbolTable`, so that symbols are one word, are compared for
+   * equality by comparing pointers, and hash to the hash of their text
+   * computed once, when the text was interned.  They serve as the keys of
+   * an `AList`, `OrderedMap` or `HashTable`, and as the atoms of a tree
+   * list, in place of strings that repeat.  Symbols are ordered by their
+   * text, so that the order does not depend on where they were
+   * allocated, except that symbols of the same text from different
+   * tables, which are not equal, are ordered by address.  The default
+   * symbol is the symbol of the empty string.
+   *
+   * Symbols constructed from text are interned in the global table, and
+   * are never released.
+   */
+  class Symbol
+  {
+  public:
+    Symbol() = default;
+
+    /**
+     * @brief Construct the symbol of the input text in the global table
+     */
+    explicit Symbol(string_view text);
+
+    string_view
+    name() const
+    {
+      return ptr ? string_view(ptr->text) : string_view();
+    }
+
+    friend string_view
+    name(Symbol x)
+    {
+      return x.name();
+    }
+
+    explicit
+    operator string_view() const
+    {
+      return name();
+    }
+
+    std::uint64_t
+    hash() const
+    {
+      return ptr ? ptr->hash : hashOf(string_view());
+    }
+
+    friend bool
+    operator==(Symbol x, Symbol y)
+    {
+      return x.ptr == y.ptr;
+    }
+
+    friend std::strong_ordering
+    operator<=>(Symbol x, Symbol y)
+    {
+      if (x.ptr == y.ptr) {
+        return std::strong_ordering::equal;
+      }
+      std::strong_ordering by_name = x.name().compare(y.name()) <=> 0;
+      return by_name != 0 ? by_name : std::compare_three_way{}(x.ptr, y.ptr);
+    }
+
+    friend ostream&
+    operator<<(ostream& os, Symbol x)
+    {
+      return os << x.name();
+    }
+
+    static std::uint64_t
+    hashOf(string_view text)
+    {
+      return std::uint64_t(std::hash<string_view>{}(text));
+    }
+
+  private:
+    friend class SymbolTable;
+
+    explicit Symbol(SymbolName const* ptr)
+      : ptr(ptr)
+    {}
+
+    SymbolName const* ptr{nullptr};
+  };
+
+  /**
+   * @brief A table of interned strings
+   *
+   * @details The table is split into shards by the hash of the text, each
+   * guarded by its own reader-writer lock, so that threads interning text
+   * that is already present only share a lock, and threads adding text
+   * only contend when the text falls in the same shard.  The names are
+   * kept until the table is destroyed, and symbols from one table are not
+   * equal to symbols of the same text from another.
+   */
+  class SymbolTable
+  {
+  public:
+    static constexpr int shard_bits = 4;
+    static constexpr size_type shard_count = size_type(1) << shard_bits;
+
+    SymbolTable() = default;
+    SymbolTable(SymbolTable const&) = delete;
+    SymbolTable& operator=(SymbolTable const&) = delete;
+
+    /**
+     * @brief Return the symbol of the input text, adding it if needed
+     */
+    Symbol
+    intern(string_view text)
+    {
+      if (text.empty()) {
+        return Symbol();
+      }
+      std::uint64_t h = Symbol::hashOf(text);
+      Shard& shard = shards[h >> (64 - shard_bits)];
+      {
+        std::shared_lock lock{shard.mex};
+        auto found = shard.names.find(text);
+        if (found != shard.names.end()) {
+          return Symbol(found->second);
+        }
+      }
+      lock_guard lock{shard.mex};
+      auto found = shard.names.find(text);
+      if (found != shard.names.end()) {
+        return Symbol(found->second);
+      }
+      shard.owned.push_back(make_unique<SymbolName const>(h, string(text)));
+      SymbolName const* name = shard.owned.back().get();
+      shard.names.emplace(name->text, name);
+      return Symbol(name);
+    }
+
+    /**
+     * @brief Return the number of symbols in the table
+     */
+    size_type
+    size() const
+    {
+      size_type result = 0;
+      for (Shard const& shard : shards) {
+        std::shared_lock lock{shard.mex};
+        result += size_type(shard.names.size());
+      }
+      return result;
+    }
+
+    /**
+     * @brief Return the table in which symbols constructed from text are
+     * interned
+     */
+    static SymbolTable&
+    global()
+    {
+      static SymbolTable table{};
+      return table;
+    }
+
+  private:
+    struct Shard
+    {
+      mutable std::shared_mutex mex{};
+      unordered_map<string_view, SymbolName const*> names{};
+      vector<unique_ptr<SymbolName const>> owned{};
+    };
+
+    array<Shard, shard_count> shards{};
+  };
+
+  inline Symbol::Symbol(string_view text)
+    : Symbol(SymbolTable::global().intern(text))
+  {}
+
+  /**
+   * @brief Return the symbol of the input text in the global table
+   */
+  inline Symbol
+  intern(string_view text)
+  {
+    return SymbolTable::global().intern(text);
+  }
+
+} // end of namespace ListProcessing::Dynamic::Details
+
+template<>
+struct std::hash<ListProcessing::Dynamic::Details::Symbol>
+{
+  std::size_t
+  operator()(ListProcessing::Dynamic::Details::Symbol x) const noexcept
+  {
+    return std::size_t(x.hash());
+  }
+};
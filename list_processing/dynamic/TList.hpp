@@ -68,8 +68,33 @@ namespace ListProcessing::Dynamic::Details {
 	, cdr(std::forward<V>(cdr)){
       }
 
-      Slot car;
-      Slot cdr;
+      /**
+       * @brief Release the pairs held only by this one in a loop, rather
+       * than by recursing once per pair, so that releasing a long or
+       * deeply nested list does not exhaust the stack.
+       */
+      ~Kernel() {
+	vector<shared_ptr<const Kernel>> pending{};
+	auto unlink = [&](Slot& slot) {
+	  auto xs = get_if<Construct>(&slot);
+	  if (xs && xs->ptr.use_count() == 1) {
+	    pending.push_back(std::move(xs->ptr));
+	  }
+	};
+	unlink(car);
+	unlink(cdr);
+	while (!pending.empty()) {
+	  shared_ptr<const Kernel> kernel = std::move(pending.back());
+	  pending.pop_back();
+	  unlink(kernel->car);
+	  unlink(kernel->cdr);
+	}
+      }
+
+      // Mutable only so that a destructor can unlink the pairs it
+      // releases; the pairs of a list are never changed otherwise.
+      mutable Slot car;
+      mutable Slot cdr;
 
     }; // end of struct Kernel
 
@@ -77,6 +102,15 @@ namespace ListProcessing::Dynamic::Details {
 
     kernel_pointer ptr{};
 
+    template<typename U>
+    friend struct Serializer;
+
+    template<typename U, typename Atom>
+    friend class SExpressionReader;
+
+    template<typename U, typename Atom>
+    friend class SExpressionPrinter;
+
   public:
 
     using value_type = T;
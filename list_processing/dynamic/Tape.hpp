@@ -18,9 +18,9 @@ namespace ListProcessing::Dynamic::Details {
     using reference = value_type&;
     using const_reference = value_type const&;
 
-    Tape()
-      : data(nil<value_type>)
-      , context(nil<value_type>)
+    constexpr Tape()
+      : data()
+      , context()
     {}
 
   private:
@@ -34,6 +34,9 @@ namespace ListProcessing::Dynamic::Details {
     data_type data;
     data_type context;
 
+    template<typename U>
+    friend struct Serializer;
+
     /**
      * @brief Return true if the elements of the tapes are
      * equal and the tapes are at the same position
@@ -487,6 +490,104 @@ namespace ListProcessing::Dynamic::Details {
       return xs.splice(ys);
     }
 
+  public:
+    /**
+     * @brief Insert the elements of a list into this tape, with the
+     * first of them under the cursor
+     */
+    template<size_type M>
+    Tape
+    insertRange(List<value_type, M> const& xs) const
+    {
+      vector<value_type const*> items{};
+      doList(xs, [&](const_reference x) { items.push_back(&x); });
+      return insertItems(items);
+    }
+
+    /**
+     * @brief Insert the elements of a range into this tape, with the
+     * first of them under the cursor
+     *
+     * @details The inserted segment is built in one pass, directly in
+     * front of the remaining elements, which are shared with this tape.
+     */
+    template<typename R>
+      requires requires(R const& xs) {
+        std::begin(xs);
+        std::end(xs);
+      }
+    Tape
+    insertRange(R const& xs) const
+    {
+      vector<value_type> values(std::begin(xs), std::end(xs));
+      vector<value_type const*> items{};
+      items.reserve(values.size());
+      for (const_reference x : values) {
+        items.push_back(&x);
+      }
+      return insertItems(items);
+    }
+
+    /**
+     * @brief Insert the elements of a range into the tape
+     */
+    template<typename R>
+    friend Tape
+    insertRange(R const& ys, Tape xs)
+    {
+      return xs.insertRange(ys);
+    }
+
+    /**
+     * @brief Remove up to n values from this tape, starting at the cursor
+     */
+    Tape
+    removeN(size_type n) const
+    {
+      return Tape(drop(data, n), context);
+    }
+
+    /**
+     * @brief Remove up to n values from the tape, starting at the cursor
+     */
+    friend Tape
+    removeN(size_type n, Tape xs)
+    {
+      return xs.removeN(n);
+    }
+
+    /**
+     * @brief Return a list of up to n values from the cursor, and this
+     * tape with those values removed
+     */
+    pair<List<T>, Tape>
+    extract(size_type n) const
+    {
+      return {take(data, n), removeN(n)};
+    }
+
+    /**
+     * @brief Return a list of up to n values from the cursor, and the
+     * tape with those values removed
+     */
+    friend pair<List<T>, Tape>
+    extract(size_type n, Tape xs)
+    {
+      return xs.extract(n);
+    }
+
+  private:
+    Tape
+    insertItems(vector<value_type const*> const& items) const
+    {
+      return Tape(
+        buildListAux(
+          [&](index_type i) -> const_reference { return *items[i]; },
+          size_type(items.size()),
+          data),
+        context);
+    }
+
     //  _       _    _    _
     // | |_ ___| |  (_)__| |_
     // |  _/ _ \ |__| (_-<  _|
@@ -545,7 +646,7 @@ namespace ListProcessing::Dynamic::Details {
   }; // end of class Tape
 
   template<typename T>
-  inline const Tape<T> empty_tape{};
+  inline constinit const Tape<T> empty_tape{};
 
   template<typename T>
   Tape<T>
@@ -0,0 +1,214 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/import.hpp>
+
+namespace ListProcessing::Dynamic::Details {
+
+  /**
+   * @brief A work-stealing pool of worker threads.
+   *
+   * @details Each worker owns a queue of tasks.  A worker pushes and pops
+   * tasks at the back of its own queue and, when that queue is empty,
+   * steals from the front of the queues of the other workers.  A thread
+   * that waits for a batch of tasks in `parallelFor` runs queued tasks
+   * while it waits, so nested parallel operations do not deadlock.
+   */
+  class ThreadPool {
+  public:
+    using Task = function<void()>;
+
+    explicit ThreadPool(size_type thread_count) {
+      assert(thread_count > 0);
+      for (index_type i = 0; i < thread_count; ++i) {
+        queues.push_back(make_unique<Queue>());
+      }
+      for (index_type i = 0; i < thread_count; ++i) {
+        workers.emplace_back([this, i] { work(i); });
+      }
+    }
+
+    ThreadPool(ThreadPool const&) = delete;
+
+    ThreadPool&
+    operator=(ThreadPool const&) = delete;
+
+    ~ThreadPool() {
+      {
+        lock_guard lock{sleep_mutex};
+        stopping = true;
+      }
+      wake.notify_all();
+      for (std::thread& worker : workers) {
+        worker.join();
+      }
+    }
+
+    /**
+     * @brief Return the number of worker threads in this pool.
+     */
+    size_type
+    size() const {
+      return size_type(workers.size());
+    }
+
+    /**
+     * @brief Return a pool shared by the parallel list operations, with
+     * one worker per hardware thread.
+     */
+    static ThreadPool&
+    global() {
+      static ThreadPool pool{
+        std::max(size_type(std::thread::hardware_concurrency()), size_type(1))};
+      return pool;
+    }
+
+    /**
+     * @brief Call the input function with each index in the half open
+     * range [0, n), in parallel, and return when all calls have returned.
+     *
+     * @details The first exception thrown by any of the calls is rethrown
+     * once all of the calls have finished.
+     */
+    template<invocable<index_type> F>
+    void
+    parallelFor(size_type n, F f) {
+      if (n <= 0) {
+        return;
+      }
+
+      atomic<size_type> remaining{n};
+      std::exception_ptr error{};
+      mutex error_mutex{};
+
+      auto run = [&](index_type i) {
+        try {
+          f(i);
+        } catch (...) {
+          lock_guard lock{error_mutex};
+          if (!error) {
+            error = std::current_exception();
+          }
+        }
+        remaining.fetch_sub(1, std::memory_order_acq_rel);
+      };
+
+      for (index_type i = n - 1; i > 0; --i) {
+        push([&run, i] { run(i); });
+      }
+      run(0);
+
+      while (remaining.load(std::memory_order_acquire) > 0) {
+        if (!tryRunOne()) {
+          std::this_thread::yield();
+        }
+      }
+
+      if (error) {
+        std::rethrow_exception(error);
+      }
+    }
+
+  private:
+    struct Queue {
+      mutex tasks_mutex{};
+      std::deque<Task> tasks{};
+    };
+
+    vector<unique_ptr<Queue>> queues{};
+    vector<std::thread> workers{};
+
+    atomic<size_type> pending{0};
+    atomic<size_type> next_queue{0};
+
+    mutex sleep_mutex{};
+    std::condition_variable wake{};
+    bool stopping{false};
+
+    inline static thread_local ThreadPool* current_pool{nullptr};
+    inline static thread_local index_type current_index{0};
+
+    bool
+    isWorker() const {
+      return current_pool == this;
+    }
+
+    void
+    push(Task task) {
+      index_type index =
+        isWorker() ? current_index
+                   : index_type(next_queue.fetch_add(1) % queues.size());
+      {
+        Queue& queue = *queues[index];
+        lock_guard lock{queue.tasks_mutex};
+        queue.tasks.push_back(std::move(task));
+      }
+      pending.fetch_add(1, std::memory_order_release);
+      {
+        lock_guard lock{sleep_mutex};
+      }
+      wake.notify_one();
+    }
+
+    optional<Task>
+    popBack(Queue& queue) {
+      lock_guard lock{queue.tasks_mutex};
+      if (queue.tasks.empty()) {
+        return nullopt;
+      }
+      Task task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+      return task;
+    }
+
+    optional<Task>
+    popFront(Queue& queue) {
+      lock_guard lock{queue.tasks_mutex};
+      if (queue.tasks.empty()) {
+        return nullopt;
+      }
+      Task task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+      return task;
+    }
+
+    /**
+     * @brief Run one queued task, preferring the calling worker's own
+     * queue, and return true if a task was run.
+     */
+    bool
+    tryRunOne() {
+      size_type n = size_type(queues.size());
+      index_type self = isWorker() ? current_index : 0;
+      optional<Task> task = isWorker() ? popBack(*queues[self]) : nullopt;
+      for (index_type i = 0; !task && i < n; ++i) {
+        task = popFront(*queues[(self + i) % n]);
+      }
+      if (task) {
+        pending.fetch_sub(1, std::memory_order_acq_rel);
+        (*task)();
+        return true;
+      }
+      return false;
+    }
+
+    void
+    work(index_type index) {
+      current_pool = this;
+      current_index = index;
+      while (true) {
+        if (!tryRunOne()) {
+          std::unique_lock lock{sleep_mutex};
+          wake.wait(lock, [this] { return stopping || pending.load() > 0; });
+          if (stopping) {
+            return;
+          }
+        }
+      }
+    }
+
+  }; // end of class ThreadPool
+
+} // end of namespace ListProcessing::Dynamic::Details
@@ -3,15 +3,674 @@
 //
 // ... List Processing header files
 //
+#include <list_processing/config.hpp>
+#include <list_processing/dynamic/ChunkedTape.hpp>
+#include <list_processing/dynamic/Parallel.hpp>
 #include <list_processing/dynamic/Tape.hpp>
+#include <list_processing/dynamic/ThreadPool.hpp>
 
 namespace ListProcessing::Dynamic::Details {
 
+  /**
+   * @brief A token that starts a branch in a preorder sequence of tree
+   * tokens
+   */
+  struct BranchOpen
+  {};
+
+  /**
+   * @brief A token that ends a branch in a preorder sequence of tree
+   * tokens
+   */
+  struct BranchClose
+  {};
+
+  constexpr BranchOpen branch_open{};
+  constexpr BranchClose branch_close{};
+
+  /**
+   * @brief An element of a preorder sequence describing a tree
+   */
+  template<typename T>
+  using TreeToken = variant<T, BranchOpen, BranchClose>;
+
   /**
    * @brief A class template describing homogeneous dynamic trees.
+   *
+   * @details The tree is edited through a zipper: the branch that is
+   * open has a focus, which is either a value or a branch, and the
+   * branches that enclose it are held in a context that is restored when
+   * the branch is closed.  The slots of each branch are stored in a
+   * `ChunkedTape`, that is, in contiguous arrays of up to `N` slots
+   * linked by a balanced tree, so visiting the slots of a branch reads
+   * consecutive memory and an edit copies only the path to the edited
+   * array.  Closing an edited branch writes it back to its parent in the
+   * same way.
    */
-  template<typename T, size_type N>
-  class Tree;
+  template<
+    typename T,
+    size_type N = ListProcessing::Config::Info::Parameters::default_chunk_size>
+  class Tree
+  {
+  public:
+    using value_type = T;
+    using const_reference = value_type const&;
+
+    constexpr Tree() = default;
+
+  private:
+    template<typename U, size_type M>
+    friend class Tree;
+
+    template<typename U>
+    friend struct Serializer;
+
+    struct Branch;
+    using branch_pointer = shared_ptr<const Branch>;
+    using node_type = variant<value_type, branch_pointer>;
+    using data_type = ChunkedTape<node_type, N>;
+
+    /**
+     * @brief A closed branch, with the number of values and branches it
+     * contains at any depth.
+     */
+    struct Branch
+    {
+      Branch(data_type data, size_type size)
+        : data(data)
+        , size(size)
+      {}
+
+      /**
+       * @brief Release the branches held only by this one in a loop,
+       * rather than by recursing once per level, so that releasing a
+       * deep tree does not exhaust the stack.
+       *
+       * @details A branch is unlinked only when this destructor holds
+       * its last reference, and only after an acquire fence, so that the
+       * writes of the threads that dropped the other references are seen.
+       */
+      ~Branch()
+      {
+        vector<branch_pointer> pending{};
+        auto unlink = [&](data_type& slots) {
+          data_type::doOwned(slots, [&](node_type const& node) {
+            auto p = get_if<branch_pointer>(&node);
+            if (p && p->use_count() == 1) {
+              std::atomic_thread_fence(std::memory_order_acquire);
+              pending.push_back(*p);
+            }
+          });
+          slots = data_type{};
+        };
+        unlink(data);
+        while (!pending.empty()) {
+          branch_pointer branch = std::move(pending.back());
+          pending.pop_back();
+          if (branch.use_count() == 1) {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            unlink(branch->data);
+          }
+        }
+      }
+
+      // Mutable only so that a destructor can unlink the branches it
+      // releases; the slots of a branch are never changed otherwise.
+      mutable data_type data;
+      size_type size;
+    }; // end of struct Branch
+
+    struct ContextElement
+    {
+      data_type data;
+      size_type size;
+      bool tainted;
+    }; // end of struct ContextElement
+
+    using Context = List<ContextElement>;
+
+    Tree(data_type data, size_type size, Context context, bool tainted)
+      : data(data)
+      , size(size)
+      , context(context)
+      , tainted(tainted)
+    {}
+
+    //
+    // ... class data
+    //
+    data_type data{};
+    size_type size{0};
+    Context context{};
+    bool tainted{false};
+
+    /**
+     * @brief Return the number of values and branches in a slot
+     */
+    static size_type
+    slotSize(node_type const& node)
+    {
+      return holds_alternative<branch_pointer>(node)
+               ? 1 + get<branch_pointer>(node)->size
+               : 1;
+    }
+
+    /**
+     * @brief Return the number of values and branches in the slot at
+     * the focus of the input branch, or zero when the focus is at the
+     * back.
+     */
+    static size_type
+    focusSize(data_type const& data)
+    {
+      return data.isAtBack() ? 0 : slotSize(data.read());
+    }
+
+    /**
+     * @brief Return the bounds of groups of consecutive slots, each with
+     * at least `grain` values and branches, except for the last.
+     */
+    static vector<index_type>
+    partitionSlots(vector<node_type const*> const& slots, size_type grain)
+    {
+      vector<index_type> bounds{0};
+      size_type count = 0;
+      for (index_type i = 0; i < index_type(slots.size()); ++i) {
+        count += slotSize(*slots[i]);
+        if (count >= grain) {
+          bounds.push_back(i + 1);
+          count = 0;
+        }
+      }
+      if (bounds.back() != index_type(slots.size())) {
+        bounds.push_back(index_type(slots.size()));
+      }
+      return bounds;
+    }
+
+    static vector<node_type const*>
+    slotsOf(data_type const& data)
+    {
+      vector<node_type const*> slots{};
+      doTape(data, [&](node_type const& node) { slots.push_back(&node); });
+      return slots;
+    }
+
+    /**
+     * @brief Visit the slots of the input branch in preorder, entering
+     * the branches for which `enter` returns true and passing every other
+     * slot to `visit`.  `leave` is called as each entered branch, and
+     * finally the input branch, is finished.
+     *
+     * @details The walk keeps its own stack of frames, so trees of any
+     * depth are visited without recursing.
+     */
+    template<typename Enter, typename Visit, typename Leave>
+    static void
+    walkSlots(data_type const& data, Enter enter, Visit visit, Leave leave)
+    {
+      struct Frame
+      {
+        vector<node_type const*> slots;
+        index_type next;
+      };
+      vector<Frame> frames(1, Frame{slotsOf(data), 0});
+      while (!frames.empty()) {
+        if (frames.back().next == index_type(frames.back().slots.size())) {
+          frames.pop_back();
+          leave();
+          continue;
+        }
+        node_type const& node = *frames.back().slots[frames.back().next++];
+        if (
+          holds_alternative<branch_pointer>(node) &&
+          enter(*get<branch_pointer>(node))) {
+          frames.push_back(Frame{slotsOf(get<branch_pointer>(node)->data), 0});
+        } else {
+          visit(node);
+        }
+      }
+    }
+
+    /**
+     * @brief Return the slots, in preorder, that remain when every
+     * branch with at least `grain` values and branches is replaced by its
+     * slots, so that each is small enough to be handled by a single task.
+     */
+    static vector<node_type const*>
+    unitsOf(data_type const& data, size_type grain)
+    {
+      vector<node_type const*> units{};
+      walkSlots(
+        data,
+        [&](Branch const& branch) { return branch.size >= grain; },
+        [&](node_type const& node) { units.push_back(&node); },
+        [] {});
+      return units;
+    }
+
+    template<typename F, typename U>
+    static void
+    reduceData(
+      F& f,
+      data_type const& data,
+      size_type size,
+      size_type grain,
+      optional<U>& partial)
+    {
+      auto always = [](Branch const&) { return true; };
+      auto reduceSlots = [&](data_type const& slots, optional<U>& partial) {
+        walkSlots(
+          slots,
+          always,
+          [&](node_type const& node) {
+            value_type const& x = get<value_type>(node);
+            partial = partial ? U(f(*partial, x)) : U(x);
+          },
+          [] {});
+      };
+
+      if (size < grain) {
+        reduceSlots(data, partial);
+        return;
+      }
+
+      vector<node_type const*> units = unitsOf(data, grain);
+      vector<index_type> bounds = partitionSlots(units, grain);
+      vector<optional<U>> partials(bounds.size() - 1);
+      ThreadPool::global().parallelFor(
+        size_type(partials.size()), [&](index_type task) {
+          for (index_type i = bounds[task]; i < bounds[task + 1]; ++i) {
+            node_type const& node = *units[i];
+            optional<U>& result = partials[task];
+            if (holds_alternative<value_type>(node)) {
+              value_type const& x = get<value_type>(node);
+              result = result ? U(f(*result, x)) : U(x);
+            } else {
+              reduceSlots(get<branch_pointer>(node)->data, result);
+            }
+          }
+        });
+      for (optional<U> const& p : partials) {
+        if (p) {
+          partial = partial ? U(f(*partial, *p)) : U(*p);
+        }
+      }
+    }
+
+    template<typename F, typename U>
+    static typename Tree<U, N>::data_type
+    mapData(F& f, data_type const& data, size_type size, size_type grain)
+    {
+      using Result = Tree<U, N>;
+      using ResultData = typename Result::data_type;
+      using ResultNode = typename Result::node_type;
+      using ResultBranch = typename Result::Branch;
+
+      // Rebuild the input branch, and the branches the walk enters, from
+      // the results that `next` returns for the other slots, in preorder.
+      auto rebuild = [&](data_type const& slots, auto enter, auto next) {
+        struct Frame
+        {
+          vector<ResultNode> slots;
+          size_type size;
+          index_type position;
+        };
+        vector<Frame> frames(1, Frame{{}, 0, slots.position()});
+        ResultData result{};
+        walkSlots(
+          slots,
+          [&](Branch const& branch) {
+            if (!enter(branch)) {
+              return false;
+            }
+            frames.push_back(Frame{{}, branch.size, branch.data.position()});
+            return true;
+          },
+          [&](node_type const& node) {
+            frames.back().slots.push_back(next(node));
+          },
+          [&] {
+            Frame frame = std::move(frames.back());
+            frames.pop_back();
+            ResultData data = ResultData(frame.slots).moveTo(frame.position);
+            if (frames.empty()) {
+              result = std::move(data);
+            } else {
+              frames.back().slots.emplace_back(
+                in_place_index<1>,
+                make_shared<const ResultBranch>(std::move(data), frame.size));
+            }
+          });
+        return result;
+      };
+
+      auto always = [](Branch const&) { return true; };
+      auto mapValue = [&](node_type const& node) {
+        return ResultNode(in_place_index<0>, f(get<value_type>(node)));
+      };
+
+      if (size < grain) {
+        return rebuild(data, always, mapValue);
+      }
+
+      vector<node_type const*> units = unitsOf(data, grain);
+      vector<optional<ResultNode>> nodes(units.size());
+      vector<index_type> bounds = partitionSlots(units, grain);
+      ThreadPool::global().parallelFor(
+        size_type(bounds.size()) - 1, [&](index_type task) {
+          for (index_type i = bounds[task]; i < bounds[task + 1]; ++i) {
+            node_type const& node = *units[i];
+            if (holds_alternative<value_type>(node)) {
+              nodes[i].emplace(mapValue(node));
+            } else {
+              branch_pointer const& p = get<branch_pointer>(node);
+              nodes[i].emplace(
+                in_place_index<1>,
+                make_shared<const ResultBranch>(
+                  rebuild(p->data, always, mapValue), p->size));
+            }
+          }
+        });
+
+      index_type next = 0;
+      return rebuild(
+        data,
+        [&](Branch const& branch) { return branch.size >= grain; },
+        [&](node_type const&) { return std::move(*nodes[next++]); });
+    }
+
+  public:
+    /**
+     * @brief Return a tree built from a preorder sequence of tokens
+     *
+     * @details Each token is a value, `branch_open`, which starts a
+     * branch, or `branch_close`, which ends the innermost open branch.
+     * The branches are built bottom up, in a single pass over the tokens,
+     * and the result is open at its root, with every focus at the front.
+     */
+    template<typename R>
+    static Tree
+    fromPreorder(R const& tokens)
+    {
+      struct Frame
+      {
+        vector<node_type> slots;
+        size_type size;
+      };
+      vector<Frame> frames(1, Frame{{}, 0});
+
+      auto add = [&](TreeToken<value_type> const& token) {
+        if (holds_alternative<value_type>(token)) {
+          frames.back().slots.emplace_back(
+            in_place_index<0>, get<value_type>(token));
+          ++frames.back().size;
+        } else if (holds_alternative<BranchOpen>(token)) {
+          frames.push_back(Frame{{}, 0});
+        } else {
+          if (frames.size() == 1) {
+            throw logic_error("Unbalanced branch_close in tree tokens");
+          }
+          Frame frame = std::move(frames.back());
+          frames.pop_back();
+          frames.back().slots.emplace_back(
+            in_place_index<1>,
+            make_shared<const Branch>(data_type(frame.slots), frame.size));
+          frames.back().size += 1 + frame.size;
+        }
+      };
+
+      if constexpr (requires { std::begin(tokens); }) {
+        for (auto const& token : tokens) {
+          add(token);
+        }
+      } else {
+        doList(tokens, add);
+      }
+
+      if (frames.size() != 1) {
+        throw logic_error("Unbalanced branch_open in tree tokens");
+      }
+      return Tree(
+        data_type(frames.back().slots), frames.back().size, Context{}, false);
+    }
+
+    /**
+     * @brief Return the result of combining the values of the tree, in
+     * preorder, with the input function, computed in parallel.
+     *
+     * @details The function must be associative.  The whole tree is
+     * combined, starting from `init`, and subtrees with at least `grain`
+     * values and branches have their slots split into parallel tasks on
+     * the global `ThreadPool`.
+     */
+    template<typename F, typename U>
+    U
+    parallelReduce(
+      F f, U const& init, size_type grain = default_grain_size) const
+    {
+      Tree xs = root(*this);
+      optional<U> partial{};
+      reduceData(f, xs.data, xs.size, grain, partial);
+      return partial ? U(f(init, *partial)) : init;
+    }
+
+    /**
+     * @brief Return a tree with the shape of this tree, holding the
+     * results of applying the input function to its values, computed in
+     * parallel.
+     *
+     * @details The whole tree is mapped, and the result is open at its
+     * root with each focus at the same position as in this tree.
+     */
+    template<typename F, typename U = decay_t<invoke_result_t<F, T const&>>>
+    Tree<U, N>
+    parallelMap(F f, size_type grain = default_grain_size) const
+    {
+      Tree xs = root(*this);
+      return Tree<U, N>(
+        mapData<F, U>(f, xs.data, xs.size, grain),
+        xs.size,
+        typename Tree<U, N>::Context{},
+        false);
+    }
+
+    /**
+     * @brief Return the number of values and branches in the tree
+     */
+    friend size_type
+    length(Tree const& xs)
+    {
+      return root(xs).size;
+    }
+
+    /**
+     * @brief Return true if the focus of the current branch is at it's final
+     * position
+     */
+    friend bool
+    isAtBack(Tree const& xs)
+    {
+      return xs.data.isAtBack();
+    }
+
+    /**
+     * @brief Return true if the focus of the currrent node is at the initial
+     * position
+     */
+    friend bool
+    isAtFront(Tree const& xs)
+    {
+      return xs.data.isAtFront();
+    }
+
+    /**
+     * @brief Return true if the current branch is empty
+     */
+    friend bool
+    isBranchEmpty(Tree const& xs)
+    {
+      return xs.data.isEmpty();
+    }
+
+    /**
+     * @brief Return true if the focus of the current node is a leaf and
+     * false if it is a branch.
+     *
+     * @details It is an error to call this function if the current node is
+     * empty
+     */
+    friend bool
+    isLeaf(Tree const& xs)
+    {
+      return holds_alternative<value_type>(xs.data.read());
+    }
+
+    /**
+     * @brief Return true if the focus of the current node is a branch and
+     * false if it is a leaf.
+     *
+     * @details It is an error to call this function if the current node is
+     * empty.
+     */
+    friend bool
+    isBranch(Tree const& xs)
+    {
+      return holds_alternative<branch_pointer>(xs.data.read());
+    }
+
+    /**
+     * @brief Return true if the tree does not have any data or structure beyond
+     * the current node
+     */
+    friend bool
+    isEmpty(Tree const& xs)
+    {
+      return xs.data.isEmpty() && isNull(xs.context);
+    }
+
+    /**
+     * @brief Insert a new value at the focus of the open node
+     */
+    friend Tree
+    insert(Tree const& xs, const_reference x)
+    {
+      return Tree(
+        xs.data.insert(node_type(x)), xs.size + 1, xs.context, true);
+    }
+
+    /**
+     * @brief Remove the branch or value that is the focus of the current node
+     */
+    friend Tree
+    remove(Tree const& xs)
+    {
+      return Tree(
+        xs.data.remove(), xs.size - focusSize(xs.data), xs.context, true);
+    }
+
+    /**
+     * @brief Replace the value that is the focus of the current node with
+     * the input value
+     */
+    friend Tree
+    write(Tree const& xs, const_reference x)
+    {
+      return Tree(
+        xs.data.write(node_type(x)),
+        xs.size - focusSize(xs.data) + 1,
+        xs.context,
+        true);
+    }
+
+    /**
+     * @brief Return the value that is the focus of the open node
+     */
+    friend value_type
+    read(Tree const& xs)
+    {
+      return get<value_type>(xs.data.read());
+    }
+
+    /**
+     * @brief Move the focus of the open node to the next item
+     */
+    friend Tree
+    fwd(Tree const& xs)
+    {
+      return Tree(xs.data.fwd(), xs.size, xs.context, xs.tainted);
+    }
+
+    /**
+     * @brief Move the focus of the open node to the previous item
+     */
+    friend Tree
+    bwd(Tree const& xs)
+    {
+      return Tree(xs.data.bwd(), xs.size, xs.context, xs.tainted);
+    }
+
+    /**
+     * @brief Insert a new branch at the focus of the current node
+     */
+    friend Tree
+    insertBranch(Tree const& xs)
+    {
+      return Tree(
+        xs.data.insert(node_type(make_shared<const Branch>(data_type{}, 0))),
+        xs.size + 1,
+        xs.context,
+        true);
+    }
+
+    /**
+     * @brief Open the branch that is the focus of the currently open node
+     */
+    friend Tree
+    open(Tree const& xs)
+    {
+      branch_pointer const& branch = get<branch_pointer>(xs.data.read());
+      return Tree(
+        branch->data,
+        branch->size,
+        cons(ContextElement{xs.data, xs.size, xs.tainted}, xs.context),
+        false);
+    }
+
+    /**
+     * @brief Close the current node of the tree
+     *
+     * @details If the current node was edited, it replaces the branch
+     * it was opened from, which copies the path to that branch in the
+     * parent.
+     */
+    friend Tree
+    close(Tree const& xs)
+    {
+      ContextElement const& parent = head(xs.context);
+      return xs.tainted
+               ? Tree(
+                   parent.data.write(
+                     node_type(make_shared<const Branch>(xs.data, xs.size))),
+                   parent.size - focusSize(parent.data) + 1 + xs.size,
+                   tail(xs.context),
+                   true)
+               : Tree(
+                   parent.data, parent.size, tail(xs.context), parent.tainted);
+    }
+
+    /**
+     * @brief Close every open node of the tree
+     */
+    friend Tree
+    root(Tree xs)
+    {
+      while (xs.context.hasData()) {
+        xs = close(xs);
+      }
+      return xs;
+    }
+  }; // end of class Tree
 
   /**
    * @brief Reference specialization fo the Tree class template
@@ -24,9 +683,9 @@ namespace ListProcessing::Dynamic::Details {
     using const_reference = value_type const&;
     using rvalue_reference = value_type&&;
 
-    Tree()
+    constexpr Tree()
       : branch()
-      , context(nil<ContextElement>)
+      , context()
       , tainted(false)
     {}
 
@@ -38,8 +697,8 @@ namespace ListProcessing::Dynamic::Details {
       using node_type = variant<value_type, branch_pointer>;
       using data_type = Tape<node_type>;
 
-      Branch()
-        : data(empty_tape<node_type>)
+      constexpr Branch()
+        : data()
       {}
 
       Branch(data_type data)
@@ -191,19 +850,37 @@ namespace ListProcessing::Dynamic::Details {
     }
 
     /**
-     * @brief Insert a branch into the into the focus of the open node
+     * @brief Replace the focus of the open node with a branch
      */
     static Tree
-    insertExistingBranch(Tree xs, Branch branch)
+    writeExistingBranch(Tree xs, Branch branch)
     {
       return Tree(
         Branch(insert(
-          xs.branch.data,
-          typename Branch::node_type(make_shared<Branch>(branch)))),
+          typename Branch::node_type(make_shared<Branch>(branch)),
+          remove(xs.branch.data))),
         xs.context,
         true);
     }
 
+    /**
+     * @brief Move the focus of the open node to the next item
+     */
+    friend Tree
+    fwd(Tree xs)
+    {
+      return Tree(Branch(fwd(xs.branch.data)), xs.context, xs.tainted);
+    }
+
+    /**
+     * @brief Move the focus of the open node to the previous item
+     */
+    friend Tree
+    bwd(Tree xs)
+    {
+      return Tree(Branch(bwd(xs.branch.data)), xs.context, xs.tainted);
+    }
+
     /**
      * @brief Open the branch that is the focus of the currently open node
      */
@@ -222,20 +899,43 @@ namespace ListProcessing::Dynamic::Details {
     friend Tree
     close(Tree xs)
     {
-      return xs.tainted ? insertExistingBranch(
-                            Tree(
-                              head(xs.context).branch,
-                              tail(xs.context),
-                              ghead(xs.context).tainted),
-                            xs.branch)
-                        : Tree(
-                            head(xs.context).branch,
-                            tail(xs.context),
-                            head(xs.context).tainted);
+      return xs.tainted
+               ? writeExistingBranch(
+                   Tree(head(xs.context).branch, tail(xs.context), true),
+                   xs.branch)
+               : Tree(
+                   head(xs.context).branch,
+                   tail(xs.context),
+                   head(xs.context).tainted);
     }
   }; // end of class Tree
 
-  template<typename T>
-  inline const Tree<T, 1> empty_tree{};
+  template<typename T, size_type N = 1>
+  inline constinit const Tree<T, N> empty_tree{};
+
+  /**
+   * @brief The empty tree with the flat, chunked layout
+   */
+  template<
+    typename T,
+    size_type N = ListProcessing::Config::Info::Parameters::default_chunk_size>
+  inline constinit const Tree<T, N> empty_chunked_tree{};
+
+  /**
+   * @brief Build a tree from a preorder sequence of tree tokens
+   */
+  class BuildTree : public Static_callable<BuildTree>
+  {
+  public:
+    template<
+      typename R,
+      typename Token = typename R::value_type,
+      typename T = variant_alternative_t<0, Token>>
+    static Tree<T>
+    call(R const& tokens)
+    {
+      return Tree<T>::fromPreorder(tokens);
+    }
+  } constexpr buildTree{};
 
 } // end of namespace ListProcessing::Dynamic::Details
@@ -8,6 +8,18 @@
 #include <list_processing/dynamic/import.hpp>
 
 namespace ListProcessing::Dynamic::Details {
+
+  /**
+   * @brief A shared, immutable value
+   *
+   * @details Values of trivially copyable types no larger than two
+   * pointers are held in the `Shared` itself, so that they are not
+   * allocated and copying them copies the value.  Other values are
+   * allocated once and shared by the copies.  A reference obtained with
+   * `*` is therefore only valid while the `Shared` it came from lives,
+   * and containers such as `Stream` return their heads by reference to
+   * the `Shared` they hold.
+   */
   template<typename T>
   class Shared
   {
@@ -16,29 +28,70 @@ namespace ListProcessing::Dynamic::Details {
     using rvalue_reference = value_type&&;
     using value_pointer = shared_ptr<const value_type>;
     using const_pointer = const value_type*;
-    value_pointer ptr;
+
+    static constexpr bool is_inline =
+      std::is_trivially_copyable_v<T> && sizeof(T) <= 2 * sizeof(void*);
+
+    using storage_type = conditional_t<is_inline, value_type, value_pointer>;
+
+    storage_type storage;
+
+    static storage_type
+    store(value_type value)
+    {
+      if constexpr (is_inline) {
+        return value;
+      } else {
+        return make_shared<value_type>(std::move(value));
+      }
+    }
+
+    const_pointer
+    get() const
+    {
+      if constexpr (is_inline) {
+        return &storage;
+      } else {
+        return storage.get();
+      }
+    }
 
   public:
     Shared() = delete;
     Shared(const_reference value)
-      : ptr(make_shared<value_type>(value))
+      : storage(store(value))
     {}
     Shared(rvalue_reference value)
-      : ptr(make_shared<value_type>(std::move(value)))
+      : storage(store(std::move(value)))
+    {}
+
+    /**
+     * @brief Construct a shared value with storage from the input
+     * allocator, unless it is held inline
+     */
+    template<typename Alloc>
+    Shared(allocator_arg_t, Alloc const& alloc, value_type value)
+      : storage([&]() -> storage_type {
+        if constexpr (is_inline) {
+          return value;
+        } else {
+          return allocate_shared<value_type>(alloc, std::move(value));
+        }
+      }())
     {}
 
-    explicit operator const_reference() const { return *ptr; }
+    explicit operator const_reference() const { return *get(); }
 
     const_reference
     operator*() const
     {
-      return *ptr;
+      return *get();
     }
 
     const_pointer
     operator->()
     {
-      return ptr.get();
+      return get();
     }
 
     friend constexpr bool
@@ -5,10 +5,16 @@
 //
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
 #include <bitset>
 #include <cassert>
 #include <concepts>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
 #include <functional>
 #include <initializer_list>
 #include <iostream>
@@ -17,9 +23,16 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
 #include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <variant>
+#include <vector>
 
 //
 // ... External header files
@@ -37,6 +50,8 @@ namespace ListProcessing::Dynamic::Details {
   using std::declval;
   using std::forward;
   using std::get;
+  using std::get_if;
+  using std::tuple;
   using std::make_pair;
   using std::move;
   using std::pair;
@@ -48,39 +63,57 @@ namespace ListProcessing::Dynamic::Details {
   using std::copy_n;
 
   using std::convertible_to;
+  using std::equality_comparable;
   using std::invocable;
 
+  using std::allocate_shared;
+  using std::allocator_arg;
+  using std::allocator_arg_t;
   using std::enable_shared_from_this;
   using std::make_shared;
   using std::make_unique;
   using std::shared_ptr;
+  using std::static_pointer_cast;
   using std::unique_ptr;
 
   using std::enable_if_t;
   using std::false_type;
 
+  using std::is_arithmetic_v;
   using std::is_assignable_v;
   using std::is_default_constructible_v;
+  using std::is_enum_v;
   using std::is_fundamental_v;
+  using std::is_integral_v;
   using std::is_invocable_r_v;
+  using std::is_signed_v;
 
   using std::common_type_t;
   using std::conditional_t;
   using std::decay_t;
   using std::invoke_result_t;
   using std::is_same_v;
+  using std::make_unsigned_t;
   using std::remove_cvref_t;
   using std::result_of_t;
 
   using std::array;
+  using std::unordered_map;
+  using std::unordered_set;
+  using std::vector;
 
   using std::holds_alternative;
+  using std::in_place_index;
   using std::variant;
+  using std::variant_alternative_t;
 
   using std::basic_ostream;
   using std::ostream;
+  using std::string;
+  using std::string_view;
   using std::to_string;
 
+  using std::atomic;
   using std::lock_guard;
   using std::mutex;
 
@@ -89,8 +122,11 @@ namespace ListProcessing::Dynamic::Details {
   using std::nullopt;
   using std::optional;
 
+  using std::index_sequence;
   using std::initializer_list;
+  using std::make_index_sequence;
 
+  using std::bit_cast;
   using std::bitset;
 
   using TypeUtility::count_types;
@@ -101,4 +137,16 @@ namespace ListProcessing::Dynamic::Details {
   using FunctionUtility::Static_curried;
   using FunctionUtility::Trampoline;
 
+  /**
+   * @brief The unsigned integer type of `N` bytes
+   */
+  template<std::size_t N>
+  using UnsignedOfSize = conditional_t<
+    N == 1,
+    std::uint8_t,
+    conditional_t<
+      N == 2,
+      std::uint16_t,
+      conditional_t<N == 4, std::uint32_t, std::uint64_t>>>;
+
 } // end of namespace ListProcessing::Dynamic::Details
@@ -4,9 +4,13 @@
 // ... List Processing header files
 //
 #include <list_processing/dynamic/AList.hpp>
+#include <list_processing/dynamic/AdaptiveAList.hpp>
 
 namespace ListProcessing::Dynamic {
+  using Details::AdaptiveAList;
+  using Details::adaptiveAList;
   using Details::alist;
+  using Details::empty_adaptive_alist;
   using Details::empty_alist;
 
 } // end of namespace ListProcessing::Dynamic
@@ -0,0 +1,14 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/Atom.hpp>
+#include <list_processing/dynamic/EpochAtom.hpp>
+
+namespace ListProcessing::Dynamic {
+  using Details::Atom;
+  using Details::Epoch;
+  using Details::EpochAtom;
+
+} // end of namespace ListProcessing::Dynamic
@@ -5,6 +5,8 @@
 //
 #include <list_processing/dynamic/List.hpp>
 #include <list_processing/dynamic/Nil.hpp>
+#include <list_processing/dynamic/Relational.hpp>
+#include <list_processing/dynamic/Sort.hpp>
 
 namespace ListProcessing::Dynamic {
   using Details::index_type;
@@ -16,7 +18,15 @@ namespace ListProcessing::Dynamic {
   using Details::list;
   using Details::List;
   using Details::ListType;
+  using Details::literal;
   using Details::nil;
   using Details::Nil;
+  using Details::hashCountBy;
+  using Details::hashDistinct;
+  using Details::hashGroupBy;
+  using Details::hashInnerJoin;
+  using Details::hashLeftJoin;
+  using Details::parallelSortList;
+  using Details::sortList;
 
 } // end of namespace ListProcessing::Dynamic
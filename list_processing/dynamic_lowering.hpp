@@ -0,0 +1,12 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/Lowering.hpp>
+
+namespace ListProcessing::Dynamic {
+  using Details::lowerAList;
+  using Details::lowerList;
+
+} // end of namespace ListProcessing::Dynamic
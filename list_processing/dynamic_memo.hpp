@@ -0,0 +1,14 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/Memo.hpp>
+
+namespace ListProcessing::Dynamic {
+  using Details::EvictionPolicy;
+  using Details::memoize;
+  using Details::Memoized;
+  using Details::MemoStatistics;
+
+} // end of namespace ListProcessing::Dynamic
@@ -0,0 +1,13 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/OrderedMap.hpp>
+
+namespace ListProcessing::Dynamic {
+  using Details::empty_ordered_map;
+  using Details::OrderedMap;
+  using Details::orderedMap;
+
+} // end of namespace ListProcessing::Dynamic
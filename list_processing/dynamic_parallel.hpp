@@ -0,0 +1,16 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/Parallel.hpp>
+#include <list_processing/dynamic/ThreadPool.hpp>
+
+namespace ListProcessing::Dynamic {
+  using Details::default_grain_size;
+  using Details::parallelFilter;
+  using Details::parallelMap;
+  using Details::parallelReduce;
+  using Details::ThreadPool;
+
+} // end of namespace ListProcessing::Dynamic
@@ -0,0 +1,17 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/Serialization.hpp>
+
+namespace ListProcessing::Dynamic {
+  using Details::Arena;
+  using Details::ArenaAllocator;
+  using Details::Decoder;
+  using Details::deserialize;
+  using Details::Encoder;
+  using Details::serialize;
+  using Details::Serializer;
+
+} // end of namespace ListProcessing::Dynamic
@@ -0,0 +1,17 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/SExpression.hpp>
+
+namespace ListProcessing::Dynamic {
+  using Details::Arena;
+  using Details::printSExpression;
+  using Details::readSExpression;
+  using Details::readSExpressions;
+  using Details::SExpressionAtom;
+  using Details::SExpressionPrinter;
+  using Details::SExpressionReader;
+
+} // end of namespace ListProcessing::Dynamic
@@ -0,0 +1,16 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/Snapshot.hpp>
+
+namespace ListProcessing::Dynamic {
+  using Details::listSnapshot;
+  using Details::mapSnapshot;
+  using Details::SnapshotBytes;
+  using Details::SnapshotList;
+  using Details::SnapshotMap;
+  using Details::writeSnapshot;
+
+} // end of namespace ListProcessing::Dynamic
@@ -4,6 +4,7 @@
 // ... List Processing header files
 //
 #include <list_processing/dynamic/Nil.hpp>
+#include <list_processing/dynamic/Relational.hpp>
 #include <list_processing/dynamic/Stream.hpp>
 
 namespace ListProcessing::Dynamic {
@@ -0,0 +1,13 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic/Symbol.hpp>
+
+namespace ListProcessing::Dynamic {
+  using Details::intern;
+  using Details::Symbol;
+  using Details::SymbolTable;
+
+} // end of namespace ListProcessing::Dynamic
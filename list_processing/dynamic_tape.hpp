@@ -3,9 +3,13 @@
 //
 // ... List Processing header files
 //
+#include <list_processing/dynamic/ChunkedTape.hpp>
 #include <list_processing/dynamic/Tape.hpp>
 
 namespace ListProcessing::Dynamic {
+  using Details::ChunkedTape;
+  using Details::chunkedTape;
+  using Details::empty_chunked_tape;
   using Details::empty_tape;
   using Details::tape;
 
@@ -3,11 +3,16 @@
 //
 // ... List Processing header files
 //
+#include <list_processing/dynamic/CompactTList.hpp>
 #include <list_processing/dynamic/TList.hpp>
 
 namespace ListProcessing::Dynamic {
 
+  using Details::CompactSlot;
+  using Details::compactList;
   using Details::Construct;
+  using Details::fromCompact;
+  using Details::toCompact;
   using ::ListProcessing::Dynamic::Details::tlist;
   constexpr auto tcons = ::ListProcessing::Dynamic::Details::tcons;
 
@@ -6,6 +6,14 @@
 #include <list_processing/dynamic/Tree.hpp>
 
 namespace ListProcessing::Dynamic {
+  using Details::branch_close;
+  using Details::branch_open;
+  using Details::BranchClose;
+  using Details::BranchOpen;
+  using Details::buildTree;
+  using Details::empty_chunked_tree;
   using Details::empty_tree;
+  using Details::Tree;
+  using Details::TreeToken;
 
 } // end of namespace ListProcessing::Dynamic
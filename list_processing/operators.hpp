@@ -20,6 +20,7 @@
 #include <list_processing/operators/collection_operators.hpp>
 #include <list_processing/operators/list_operators.hpp>
 #include <list_processing/operators/queue_operators.hpp>
+#include <list_processing/operators/relational_operators.hpp>
 #include <list_processing/operators/stack_operators.hpp>
 #include <list_processing/operators/tape_operators.hpp>
 
@@ -70,6 +71,9 @@ namespace ListProcessing::Operators {
   constexpr auto toFront = Details::toFront;
   constexpr auto toBack = Details::toBack;
   constexpr auto splice = Details::splice;
+  constexpr auto insertRange = Details::insertRange;
+  constexpr auto removeN = Details::removeN;
+  constexpr auto extract = Details::extract;
 
   using Details::HasHead;
   using Details::HasTail;
@@ -85,4 +89,10 @@ namespace ListProcessing::Operators {
   constexpr auto filter = Details::filter;
   constexpr auto sort = Details::sort;
 
+  constexpr auto groupBy = Details::groupBy;
+  constexpr auto countBy = Details::countBy;
+  constexpr auto distinct = Details::distinct;
+  constexpr auto innerJoin = Details::innerJoin;
+  constexpr auto leftJoin = Details::leftJoin;
+
 } // end of namespace ListProcessing::Operators
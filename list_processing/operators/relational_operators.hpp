@@ -0,0 +1,102 @@
+#pragma once
+
+//
+// ... List Processing header files
+//
+#include <list_processing/operators/import.hpp>
+
+namespace ListProcessing::Operators::Details {
+
+  template<typename T, typename F>
+  concept HasGroupBy = requires(F&& key, T&& xs) {
+    { std::forward<T>(xs).groupBy(std::forward<F>(key)) };
+  };
+
+  /**
+   * @brief Group the elements of a collection by key
+   */
+  class GroupBy : public Static_curried<GroupBy, Nat<2>> {
+  public:
+    template<typename F, HasGroupBy<F> T>
+    static constexpr auto
+    call(F&& key, T&& xs) {
+      return std::forward<T>(xs).groupBy(std::forward<F>(key));
+    }
+  } constexpr groupBy{};
+
+  template<typename T, typename F>
+  concept HasCountBy = requires(F&& key, T&& xs) {
+    { std::forward<T>(xs).countBy(std::forward<F>(key)) };
+  };
+
+  /**
+   * @brief Count the elements of a collection by key
+   */
+  class CountBy : public Static_curried<CountBy, Nat<2>> {
+  public:
+    template<typename F, HasCountBy<F> T>
+    static constexpr auto
+    call(F&& key, T&& xs) {
+      return std::forward<T>(xs).countBy(std::forward<F>(key));
+    }
+  } constexpr countBy{};
+
+  template<typename T>
+  concept HasDistinct = requires(T&& xs) {
+    { std::forward<T>(xs).distinct() };
+  };
+
+  /**
+   * @brief Remove repeated elements from a collection
+   */
+  class Distinct : public Static_curried<Distinct, Nat<1>> {
+  public:
+    template<HasDistinct T>
+    static constexpr auto
+    call(T&& xs) {
+      return std::forward<T>(xs).distinct();
+    }
+  } constexpr distinct{};
+
+  template<typename T, typename F, typename U>
+  concept HasInnerJoin = requires(F&& key, U&& ys, T&& xs) {
+    {
+      std::forward<T>(xs).innerJoin(std::forward<F>(key), std::forward<U>(ys))
+    };
+  };
+
+  /**
+   * @brief Pair the elements of two collections with equal keys
+   */
+  class InnerJoin : public Static_curried<InnerJoin, Nat<3>> {
+  public:
+    template<typename F, typename U, HasInnerJoin<F, U> T>
+    static constexpr auto
+    call(F&& key, U&& ys, T&& xs) {
+      return std::forward<T>(xs).innerJoin(
+        std::forward<F>(key), std::forward<U>(ys));
+    }
+  } constexpr innerJoin{};
+
+  template<typename T, typename F, typename U>
+  concept HasLeftJoin = requires(F&& key, U&& ys, T&& xs) {
+    {
+      std::forward<T>(xs).leftJoin(std::forward<F>(key), std::forward<U>(ys))
+    };
+  };
+
+  /**
+   * @brief Pair the elements of two collections with equal keys, keeping
+   * the elements of the left-hand collection that have no match
+   */
+  class LeftJoin : public Static_curried<LeftJoin, Nat<3>> {
+  public:
+    template<typename F, typename U, HasLeftJoin<F, U> T>
+    static constexpr auto
+    call(F&& key, U&& ys, T&& xs) {
+      return std::forward<T>(xs).leftJoin(
+        std::forward<F>(key), std::forward<U>(ys));
+    }
+  } constexpr leftJoin{};
+
+} // end of namespace ListProcessing::Operators::Details
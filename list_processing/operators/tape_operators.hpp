@@ -212,4 +212,46 @@ namespace ListProcessing::Operators::Details {
     }
   } constexpr splice{};
 
+  template<typename T, typename R>
+  concept HasInsertRange = requires(R&& ys, T&& xs) {
+    { std::forward<T>(xs).insertRange(std::forward<R>(ys)) };
+  };
+
+  class InsertRange : public Static_curried<InsertRange, Nat<2>> {
+  public:
+    template<typename R, HasInsertRange<R> T>
+    static constexpr auto
+    call(R&& ys, T&& xs) {
+      return std::forward<T>(xs).insertRange(std::forward<R>(ys));
+    }
+  } constexpr insertRange{};
+
+  template<typename T, typename I>
+  concept HasRemoveN = requires(I&& n, T&& xs) {
+    { std::forward<T>(xs).removeN(std::forward<I>(n)) };
+  };
+
+  class RemoveN : public Static_curried<RemoveN, Nat<2>> {
+  public:
+    template<typename I, HasRemoveN<I> T>
+    static constexpr auto
+    call(I&& n, T&& xs) {
+      return std::forward<T>(xs).removeN(std::forward<I>(n));
+    }
+  } constexpr removeN{};
+
+  template<typename T, typename I>
+  concept HasExtract = requires(I&& n, T&& xs) {
+    { std::forward<T>(xs).extract(std::forward<I>(n)) };
+  };
+
+  class Extract : public Static_curried<Extract, Nat<2>> {
+  public:
+    template<typename I, HasExtract<I> T>
+    static constexpr auto
+    call(I&& n, T&& xs) {
+      return std::forward<T>(xs).extract(std::forward<I>(n));
+    }
+  } constexpr extract{};
+
 } // end of namespace ListProcessing::Operators::Details
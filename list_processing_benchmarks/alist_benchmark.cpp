@@ -0,0 +1,136 @@
+//
+// ... Benchmark header files
+//
+#include <benchmark/benchmark.h>
+
+//
+// ... Standard header files
+//
+#include <utility>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic.hpp>
+
+namespace ListProcessing::Dynamic::Benchmarks {
+
+  using Details::AList;
+  using Details::index_type;
+  using Details::Trampoline;
+  using std::pair;
+
+  using Alist = AList<int, int>;
+  using Data = Alist::data_type;
+
+  Alist
+  makeAList(int n)
+  {
+    Alist xs{};
+    for (int i = 0; i < n; ++i) {
+      xs = xs.set(i, i);
+    }
+    return xs;
+  }
+
+  /**
+   * @brief A lookup written with a trampoline, as the alist lookups were,
+   * for comparison with the loop over the nodes.
+   */
+  Trampoline<bool>
+  trampolinedHasKey(int key, Data xs)
+  {
+    using tramp = Trampoline<bool>;
+    return xs.hasData() ? (head(xs).first == key ? tramp(true) : tramp([=] {
+      return trampolinedHasKey(key, tail(xs));
+    }))
+                        : tramp(false);
+  }
+
+  void
+  TrampolinedHasKey(benchmark::State& state)
+  {
+    Alist xs = makeAList(int(state.range(0)));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(bool(trampolinedHasKey(0, xs.toList())));
+    }
+  }
+  BENCHMARK(TrampolinedHasKey)->Range(8, 1024);
+
+  void
+  HasKey(benchmark::State& state)
+  {
+    Alist xs = makeAList(int(state.range(0)));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(hasKey(0, xs));
+    }
+  }
+  BENCHMARK(HasKey)->Range(8, 1024);
+
+  void
+  ForceGet(benchmark::State& state)
+  {
+    Alist xs = makeAList(int(state.range(0)));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(forceGet(0, -1, xs));
+    }
+  }
+  BENCHMARK(ForceGet)->Range(8, 1024);
+
+  void
+  MaybeGet(benchmark::State& state)
+  {
+    Alist xs = makeAList(int(state.range(0)));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(maybeGet(0, xs));
+    }
+  }
+  BENCHMARK(MaybeGet)->Range(8, 1024);
+
+  void
+  Unset(benchmark::State& state)
+  {
+    Alist xs = makeAList(int(state.range(0)));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(unset(0, xs));
+    }
+  }
+  BENCHMARK(Unset)->Range(8, 1024);
+
+  void
+  AdaptiveForceGet(benchmark::State& state)
+  {
+    AdaptiveAList<int, int> xs{};
+    for (int i = 0; i < state.range(0); ++i) {
+      xs = xs.set(i, i);
+    }
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(forceGet(0, -1, xs));
+    }
+  }
+  BENCHMARK(AdaptiveForceGet)->Range(8, 1024);
+
+  void
+  ListLength(benchmark::State& state)
+  {
+    auto f = [](index_type i) { return pair(i, i); };
+    auto xs = buildList(f, state.range(0));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(length(xs));
+    }
+  }
+  BENCHMARK(ListLength)->Range(8, 1024);
+
+  void
+  ListEquality(benchmark::State& state)
+  {
+    auto f = [](index_type i) { return pair(i, i); };
+    auto xs = buildList(f, state.range(0));
+    auto ys = buildList(f, state.range(0));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(xs == ys);
+    }
+  }
+  BENCHMARK(ListEquality)->Range(8, 1024);
+
+} // end of namespace ListProcessing::Dynamic::Benchmarks
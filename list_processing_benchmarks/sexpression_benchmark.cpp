@@ -0,0 +1,60 @@
+//
+// ... Benchmark header files
+//
+#include <benchmark/benchmark.h>
+
+//
+// ... Standard header files
+//
+#include <string>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic_sexpression.hpp>
+
+namespace ListProcessing::Dynamic::Benchmarks {
+
+  using std::string;
+
+  /**
+   * @brief Return a rule set of the input number of rules, each a nested
+   * list of symbols, numbers and strings, about 100 bytes long.
+   */
+  string
+  makeRules(int n)
+  {
+    string text{};
+    for (int i = 0; i < n; ++i) {
+      text += "(rule r" + std::to_string(i) +
+              " (when (> load 0." + std::to_string(i % 100) +
+              ") (and ready \"queue " + std::to_string(i % 7) +
+              "\")) (then (scale 2) (notify ops)))\n";
+    }
+    return text;
+  }
+
+  void
+  ReadSExpressions(benchmark::State& state)
+  {
+    string text = makeRules(int(state.range(0)));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(readSExpressions<string>(text));
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * text.size());
+  }
+  BENCHMARK(ReadSExpressions)->Range(1 << 10, 1 << 16);
+
+  void
+  PrintSExpressions(benchmark::State& state)
+  {
+    string text = makeRules(int(state.range(0)));
+    auto xs = readSExpressions<string>(text);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(printSExpression(xs));
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * text.size());
+  }
+  BENCHMARK(PrintSExpressions)->Range(1 << 10, 1 << 16);
+
+} // end of namespace ListProcessing::Dynamic::Benchmarks
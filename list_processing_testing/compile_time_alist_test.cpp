@@ -24,6 +24,7 @@
 
 using ListProcessing::CompileTime::alist;
 using ListProcessing::CompileTime::empty_alist;
+using ListProcessing::CompileTime::flatAList;
 using ListProcessing::CompileTime::hasKeyByType;
 using ListProcessing::CompileTime::list;
 using ListProcessing::CompileTime::nothing;
@@ -325,6 +326,43 @@ namespace ListProcessing::Testing {
     EXPECT_FALSE((hasKeyByType<decltype(y), decltype(set(x, 3, empty_alist))>));
   }
 
+  TEST(AList, TryGetReturnsNewestValue)
+  {
+    constexpr auto xs = set(KEY("x"), 4, set(KEY("x"), 3, empty_alist));
+    STATIC_EXPECT_EQ(tryGet(KEY("x"), xs), 4);
+    STATIC_EXPECT_EQ(tryGet(KEY("x"), unset(KEY("x"), xs)), 3);
+  }
+
+  template<int I>
+  struct IndexKey
+  {
+    friend std::ostream&
+    operator<<(std::ostream& os, IndexKey)
+    {
+      return os << I << "_index_key";
+    }
+  };
+
+  template<int... Is>
+  constexpr auto
+  indexTable(std::integer_sequence<int, Is...>)
+  {
+    return flatAList(pair(IndexKey<Is>{}, Is * Is)...);
+  }
+
+  TEST(AList, LargeTableLookup)
+  {
+    constexpr auto xs = indexTable(std::make_integer_sequence<int, 48>());
+    STATIC_EXPECT_EQ(tryGet(IndexKey<0>{}, xs), 0);
+    STATIC_EXPECT_EQ(tryGet(IndexKey<24>{}, xs), 576);
+    STATIC_EXPECT_EQ(tryGet(IndexKey<47>{}, xs), 2209);
+    STATIC_EXPECT_EQ(forceGet(IndexKey<48>{}, -1, xs), -1);
+    STATIC_EXPECT_TRUE(hasKey(IndexKey<47>{}, xs));
+    STATIC_EXPECT_FALSE(hasKey(IndexKey<48>{}, xs));
+    EXPECT_TRUE((hasKeyByType<IndexKey<7>, decltype(xs)>));
+    EXPECT_FALSE((hasKeyByType<IndexKey<49>, decltype(xs)>));
+  }
+
   TEST(AList, Keys)
   {
     EXPECT_EQ(
@@ -0,0 +1,149 @@
+//
+// ... Standard header files
+//
+#include <utility>
+
+//
+// ... Testing header files
+//
+#include <gtest/gtest.h>
+#include <list_processing_testing/static_checks.hpp>
+
+//
+// ... External header files
+//
+#include <type_utility/type_utility.hpp>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/compile_time.hpp>
+#include <list_processing/compile_time_alist.hpp>
+#include <list_processing/operators.hpp>
+
+namespace {
+
+  using TypeUtility::nat;
+  using TypeUtility::type;
+
+  using ListProcessing::CompileTime::cons;
+  using ListProcessing::CompileTime::empty_flat_alist;
+  using ListProcessing::CompileTime::empty_flat_queue;
+  using ListProcessing::CompileTime::empty_flat_stack;
+  using ListProcessing::CompileTime::FlatList;
+  using ListProcessing::CompileTime::flatAList;
+  using ListProcessing::CompileTime::flatList;
+  using ListProcessing::CompileTime::length_;
+  using ListProcessing::CompileTime::list;
+  using ListProcessing::CompileTime::make_flat_stack;
+  using ListProcessing::CompileTime::makeFlatQueue;
+  using ListProcessing::CompileTime::makeFlatTape;
+  using ListProcessing::CompileTime::toFlatList;
+
+  using std::pair;
+
+  template<int I>
+  struct Field
+  {
+    friend std::ostream&
+    operator<<(std::ostream& os, Field)
+    {
+      return os << "field" << I;
+    }
+  };
+
+} // end of anonymous namespace
+
+namespace ListProcessing::Testing {
+
+  TEST(CompileTimeFlatList, Basics)
+  {
+    constexpr auto xs = flatList(1, 'a', 2.5);
+    STATIC_EXPECT_EQ(length(xs), 3);
+    STATIC_EXPECT_EQ(length_(type<std::decay_t<decltype(xs)>>), 3);
+    STATIC_EXPECT_EQ(head(xs), 1);
+    STATIC_EXPECT_EQ(tail(xs), flatList('a', 2.5));
+    STATIC_EXPECT_EQ(listRef(nat<2>, xs), 2.5);
+    STATIC_EXPECT_EQ(cons(0, xs), flatList(0, 1, 'a', 2.5));
+    STATIC_EXPECT_FALSE(isEmpty(xs));
+    STATIC_EXPECT_TRUE(isEmpty(tail(tail(tail(xs)))));
+  }
+
+  TEST(CompileTimeFlatList, Transformations)
+  {
+    constexpr auto xs = flatList(1, 2, 3);
+    STATIC_EXPECT_EQ(reverse(xs), flatList(3, 2, 1));
+    STATIC_EXPECT_EQ(append(xs, flatList(4, 5)), flatList(1, 2, 3, 4, 5));
+    STATIC_EXPECT_EQ(take(nat<2>, xs), flatList(1, 2));
+    STATIC_EXPECT_EQ(drop(nat<2>, xs), flatList(3));
+    STATIC_EXPECT_EQ(
+      mapList([](auto x) { return x * 2; }, xs), flatList(2, 4, 6));
+    STATIC_EXPECT_EQ(
+      foldl([](auto x, auto y) { return x * 10 + y; }, 0, xs), 123);
+  }
+
+  TEST(CompileTimeFlatList, FromCells)
+  {
+    STATIC_EXPECT_EQ(toFlatList(list(1, 'b', 3)), flatList(1, 'b', 3));
+  }
+
+  template<int... Is>
+  constexpr auto
+  wideList(std::integer_sequence<int, Is...>)
+  {
+    return flatList(Is...);
+  }
+
+  TEST(CompileTimeFlatList, WideListRef)
+  {
+    constexpr auto xs = wideList(std::make_integer_sequence<int, 200>());
+    STATIC_EXPECT_EQ(listRef(nat<0>, xs), 0);
+    STATIC_EXPECT_EQ(listRef(nat<199>, xs), 199);
+    STATIC_EXPECT_EQ(xs.at(nat<123>), 123);
+  }
+
+  TEST(CompileTimeFlatList, Stack)
+  {
+    constexpr auto xs = make_flat_stack('a', 'b', 'c');
+    STATIC_EXPECT_EQ(top(xs), 'a');
+    STATIC_EXPECT_EQ(top(pop(xs)), 'b');
+    STATIC_EXPECT_EQ(swap(xs), make_flat_stack('b', 'a', 'c'));
+    STATIC_EXPECT_TRUE(isEmpty(pop(pop(pop(xs)))));
+    STATIC_EXPECT_EQ(top(push('x', empty_flat_stack)), 'x');
+  }
+
+  TEST(CompileTimeFlatList, Queue)
+  {
+    constexpr auto xs = push('c', makeFlatQueue('a', 'b'));
+    ASSERT_EQ(front(xs), 'a');
+    ASSERT_EQ(front(pop(xs)), 'b');
+    ASSERT_EQ(front(pop(pop(xs))), 'c');
+    ASSERT_TRUE(isEmpty(pop(pop(pop(xs)))));
+    ASSERT_EQ(front(push('a', empty_flat_queue)), 'a');
+  }
+
+  TEST(CompileTimeFlatList, Tape)
+  {
+    constexpr auto xs = makeFlatTape('a', 'b', 'c');
+    STATIC_EXPECT_EQ(read(xs), 'a');
+    STATIC_EXPECT_EQ(read(fwd(fwd(xs))), 'c');
+    STATIC_EXPECT_EQ(position(fwd(xs)), 1);
+    STATIC_EXPECT_EQ(read(write('z', fwd(xs))), 'z');
+    STATIC_EXPECT_TRUE(isAtBack(toBack(xs)));
+  }
+
+  TEST(CompileTimeFlatList, AList)
+  {
+    constexpr auto xs = flatAList(
+      pair(Field<0>{}, 1), pair(Field<1>{}, 'b'), pair(Field<0>{}, 3));
+    STATIC_EXPECT_TRUE(hasKey(Field<1>{}, xs));
+    STATIC_EXPECT_FALSE(hasKey(Field<2>{}, xs));
+    STATIC_EXPECT_EQ(tryGet(Field<0>{}, xs), 1);
+    STATIC_EXPECT_EQ(tryGet(Field<0>{}, unset(Field<0>{}, xs)), 3);
+    STATIC_EXPECT_EQ(forceGet(Field<2>{}, 0, xs), 0);
+    STATIC_EXPECT_EQ(
+      tryGet(Field<2>{}, set(Field<2>{}, 2.5, empty_flat_alist)), 2.5);
+    STATIC_EXPECT_FALSE(hasKey(Field<1>{}, remove(Field<1>{}, xs)));
+  }
+
+} // end of namespace ListProcessing::Testing
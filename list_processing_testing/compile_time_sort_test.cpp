@@ -0,0 +1,122 @@
+//
+// ... Standard header files
+//
+#include <functional>
+
+//
+// ... Testing header files
+//
+#include <gtest/gtest.h>
+#include <list_processing_testing/static_checks.hpp>
+
+//
+// ... External header files
+//
+#include <type_utility/type_utility.hpp>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/compile_time.hpp>
+
+namespace {
+
+  using TypeUtility::Nat;
+  using TypeUtility::nat;
+  using TypeUtility::type;
+
+  using ListProcessing::CompileTime::flatList;
+  using ListProcessing::CompileTime::groupBy;
+  using ListProcessing::CompileTime::list;
+  using ListProcessing::CompileTime::partition;
+  using ListProcessing::CompileTime::sortBy;
+  using ListProcessing::CompileTime::unique;
+
+  constexpr auto value = [](auto n) { return decltype(n)::value; };
+
+  constexpr auto size = [](auto t) {
+    return sizeof(typename decltype(t)::type);
+  };
+
+  constexpr auto parity = [](auto n) { return decltype(n)::value % 2; };
+
+  constexpr auto isOdd = [](auto n) { return decltype(n)::value % 2 == 1; };
+
+  template<size_t... Ns>
+  constexpr auto
+  reversedNats(std::index_sequence<Ns...>)
+  {
+    return flatList(nat<sizeof...(Ns) - 1 - Ns>...);
+  }
+
+} // end of anonymous namespace
+
+namespace ListProcessing::Testing {
+
+  TEST(CompileTimeSort, SortNats)
+  {
+    STATIC_EXPECT_EQ(
+      sortBy(value, list(nat<3>, nat<1>, nat<2>)),
+      list(nat<1>, nat<2>, nat<3>));
+    STATIC_EXPECT_EQ(sortBy(value, list()), list());
+  }
+
+  TEST(CompileTimeSort, SortIsStable)
+  {
+    constexpr auto xs = sortBy(parity, list(nat<1>, nat<2>, nat<3>, nat<4>));
+    STATIC_EXPECT_EQ(xs, list(nat<2>, nat<4>, nat<1>, nat<3>));
+  }
+
+  TEST(CompileTimeSort, SortTypeList)
+  {
+    STATIC_EXPECT_TRUE(
+      sortBy(size, list(type<double>, type<char>, type<int>)) ==
+      list(type<char>, type<int>, type<double>));
+  }
+
+  TEST(CompileTimeSort, SortKeepsFlatLists)
+  {
+    STATIC_EXPECT_EQ(
+      sortBy(value, flatList(nat<2>, nat<0>, nat<1>)),
+      flatList(nat<0>, nat<1>, nat<2>));
+  }
+
+  TEST(CompileTimeSort, SortWideList)
+  {
+    constexpr auto xs =
+      sortBy(value, reversedNats(std::make_index_sequence<128>()));
+    STATIC_EXPECT_EQ(xs.at(nat<0>), nat<0>);
+    STATIC_EXPECT_EQ(xs.at(nat<127>), nat<127>);
+  }
+
+  TEST(CompileTimeSort, SortByComparison)
+  {
+    STATIC_EXPECT_EQ(
+      sort(std::greater{}, flatList(nat<1>, nat<3>, nat<2>)),
+      flatList(nat<3>, nat<2>, nat<1>));
+  }
+
+  TEST(CompileTimeSort, Unique)
+  {
+    STATIC_EXPECT_TRUE(
+      unique(
+        [](auto t) { return t; },
+        list(type<int>, type<char>, type<int>, type<double>, type<char>)) ==
+      list(type<int>, type<char>, type<double>));
+  }
+
+  TEST(CompileTimeSort, Partition)
+  {
+    constexpr auto parts = partition(isOdd, list(nat<1>, nat<2>, nat<3>));
+    STATIC_EXPECT_EQ(parts.first, list(nat<1>, nat<3>));
+    STATIC_EXPECT_EQ(parts.second, list(nat<2>));
+  }
+
+  TEST(CompileTimeSort, GroupBy)
+  {
+    STATIC_EXPECT_EQ(
+      groupBy(parity, list(nat<1>, nat<2>, nat<3>, nat<4>, nat<5>)),
+      list(list(nat<1>, nat<3>, nat<5>), list(nat<2>, nat<4>)));
+  }
+
+} // end of namespace ListProcessing::Testing
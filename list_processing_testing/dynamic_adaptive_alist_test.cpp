@@ -0,0 +1,139 @@
+//
+// ... Standard header files
+//
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+//
+// ... Testing header files
+//
+#include <gtest/gtest.h>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic.hpp>
+#include <list_processing/dynamic_alist.hpp>
+
+using std::nullopt;
+using std::optional;
+using std::pair;
+
+using ListProcessing::Dynamic::AdaptiveAList;
+using ListProcessing::Dynamic::adaptiveAList;
+using ListProcessing::Dynamic::alist;
+using ListProcessing::Dynamic::empty_adaptive_alist;
+using ListProcessing::Dynamic::empty_alist;
+using ListProcessing::Dynamic::list;
+
+namespace ListProcessing::Testing {
+
+  TEST(AdaptiveAList, EmptyIsEmpty)
+  {
+    ASSERT_TRUE(isEmpty(empty_adaptive_alist<char, int>));
+    ASSERT_FALSE(hasData(empty_adaptive_alist<char, int>));
+  }
+
+  TEST(AdaptiveAList, SetAndGet)
+  {
+    auto xs = set('a', 1, set('b', 2, empty_adaptive_alist<char, int>));
+    ASSERT_TRUE(hasKey('a', xs));
+    ASSERT_FALSE(hasKey('c', xs));
+    ASSERT_EQ(tryGet('b', xs), 2);
+    ASSERT_EQ(forceGet('c', 3, xs), 3);
+    ASSERT_EQ(maybeGet('a', xs), optional<int>(1));
+    ASSERT_EQ(maybeGet('c', xs), nullopt);
+    ASSERT_THROW(tryGet('c', xs), std::logic_error);
+  }
+
+  TEST(AdaptiveAList, PromotesPastThreshold)
+  {
+    AdaptiveAList<int, int, 4> xs{};
+    for (int i = 0; i < 4; ++i) {
+      xs = xs.set(i, i);
+    }
+    ASSERT_FALSE(xs.isHashed());
+    xs = xs.set(4, 4);
+    ASSERT_TRUE(xs.isHashed());
+    ASSERT_EQ(length(xs), 5u);
+    for (int i = 0; i < 5; ++i) {
+      ASSERT_EQ(tryGet(i, xs), i);
+    }
+  }
+
+  TEST(AdaptiveAList, DemotesAfterShrinking)
+  {
+    AdaptiveAList<int, int, 4> xs{};
+    for (int i = 0; i < 6; ++i) {
+      xs = xs.set(i, i);
+    }
+    xs = xs.set(0, 10);
+    ASSERT_TRUE(xs.isHashed());
+    xs = remove(5, remove(4, remove(3, remove(2, xs))));
+    ASSERT_TRUE(xs.isHashed());
+    xs = unset(1, xs);
+    ASSERT_FALSE(xs.isHashed());
+    ASSERT_EQ(toList(xs), list(pair(0, 10), pair(0, 0)));
+    xs = unset(0, xs);
+    ASSERT_EQ(tryGet(0, xs), 0);
+  }
+
+  TEST(AdaptiveAList, ShadowingSurvivesPromotion)
+  {
+    AdaptiveAList<int, int, 4> xs{};
+    xs = xs.set(1, 10).set(1, 11).set(2, 20);
+    for (int i = 3; i < 10; ++i) {
+      xs = xs.set(i, i);
+    }
+    xs = xs.set(1, 12);
+    ASSERT_TRUE(xs.isHashed());
+    ASSERT_EQ(tryGet(1, xs), 12);
+    xs = unset(1, xs);
+    ASSERT_EQ(tryGet(1, xs), 11);
+    xs = unset(1, xs);
+    ASSERT_EQ(tryGet(1, xs), 10);
+    xs = unset(1, xs);
+    ASSERT_FALSE(hasKey(1, xs));
+  }
+
+  TEST(AdaptiveAList, RemoveErasesEveryAssociation)
+  {
+    auto xs = adaptiveAList(
+      pair('a', 1), pair('b', 2), pair('a', 3), pair('c', 4));
+    xs = remove('a', xs);
+    ASSERT_FALSE(hasKey('a', xs));
+    ASSERT_EQ(length(xs), 2u);
+  }
+
+  TEST(AdaptiveAList, AgreesWithAList)
+  {
+    for (int n : {3, 30, 3000}) {
+      auto xs = empty_alist<int, int>;
+      auto ys = empty_adaptive_alist<int, int>;
+      for (int i = 0; i < n; ++i) {
+        xs = set(i % 7, i, xs);
+        ys = set(i % 7, i, ys);
+      }
+      for (int k = 0; k < 7; k += 2) {
+        xs = xs.unset(k);
+        ys = ys.unset(k);
+      }
+      ASSERT_EQ(toList(ys), toList(xs));
+      ASSERT_EQ(keys(ys), keys(xs));
+      ASSERT_EQ(vals(ys), vals(xs));
+      for (int k = 0; k < 8; ++k) {
+        ASSERT_EQ(maybeGet(k, ys), maybeGet(k, xs));
+      }
+    }
+  }
+
+  TEST(AdaptiveAList, ConvertsFromAList)
+  {
+    auto xs = alist(pair('a', 1), pair('b', 2), pair('a', 3));
+    AdaptiveAList<char, int> ys(xs);
+    ASSERT_EQ(ys.toList(), xs.toList());
+    ASSERT_EQ(tryGet('a', ys), 1);
+  }
+
+} // end of namespace ListProcessing::Testing
@@ -0,0 +1,188 @@
+//
+// ... Standard header files
+//
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+//
+// ... Testing header files
+//
+#include <gtest/gtest.h>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic_atom.hpp>
+#include <list_processing/dynamic_list.hpp>
+
+using ListProcessing::Dynamic::Atom;
+using ListProcessing::Dynamic::Epoch;
+using ListProcessing::Dynamic::EpochAtom;
+using ListProcessing::Dynamic::list;
+using ListProcessing::Dynamic::ListType;
+using ListProcessing::Dynamic::nil;
+
+namespace ListProcessing::Testing {
+
+  TEST(DynamicAtom, DefaultHoldsEmptyValue) {
+    Atom<ListType<int>> atom;
+    ASSERT_EQ(atom.load(), nil<int>);
+  }
+
+  TEST(DynamicAtom, LoadMem) {
+    Atom<ListType<int>> atom(list(1, 2, 3));
+    ASSERT_EQ(atom.load(), list(1, 2, 3));
+  }
+
+  TEST(DynamicAtom, LoadFriend) {
+    Atom<ListType<int>> atom(list(1, 2, 3));
+    ASSERT_EQ(load(atom), list(1, 2, 3));
+  }
+
+  TEST(DynamicAtom, Store) {
+    Atom<ListType<int>> atom(list(1, 2, 3));
+    store(atom, list(4, 5));
+    ASSERT_EQ(load(atom), list(4, 5));
+  }
+
+  TEST(DynamicAtom, SnapshotSurvivesStore) {
+    Atom<ListType<int>> atom(list(1, 2, 3));
+    auto snapshot = load(atom);
+    store(atom, list(4, 5));
+    ASSERT_EQ(snapshot, list(1, 2, 3));
+  }
+
+  TEST(DynamicAtom, Exchange) {
+    Atom<ListType<int>> atom(list(1, 2, 3));
+    ASSERT_EQ(exchange(atom, list(4, 5)), list(1, 2, 3));
+    ASSERT_EQ(load(atom), list(4, 5));
+  }
+
+  TEST(DynamicAtom, CompareExchangeSucceeds) {
+    Atom<ListType<int>> atom(list(1, 2, 3));
+    auto expected = list(1, 2, 3);
+    ASSERT_TRUE(compareExchange(atom, expected, list(4, 5)));
+    ASSERT_EQ(load(atom), list(4, 5));
+  }
+
+  TEST(DynamicAtom, CompareExchangeFails) {
+    Atom<ListType<int>> atom(list(1, 2, 3));
+    auto expected = list(7);
+    ASSERT_FALSE(compareExchange(atom, expected, list(4, 5)));
+    ASSERT_EQ(expected, list(1, 2, 3));
+    ASSERT_EQ(load(atom), list(1, 2, 3));
+  }
+
+  TEST(DynamicAtom, Swap) {
+    Atom<ListType<int>> atom(list(2, 3));
+    auto result = swap(atom, [](auto xs) { return cons(1, xs); });
+    ASSERT_EQ(result, list(1, 2, 3));
+    ASSERT_EQ(load(atom), list(1, 2, 3));
+  }
+
+  TEST(DynamicAtom, ConcurrentSwapsAreNotLost) {
+    constexpr int thread_count = 8;
+    constexpr int swaps_per_thread = 500;
+    Atom<ListType<int>> atom;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+      threads.emplace_back([&, i] {
+        for (int j = 0; j < swaps_per_thread; ++j) {
+          swap(atom, [=](auto xs) { return cons(i, xs); });
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    ASSERT_EQ(length(load(atom)), thread_count * swaps_per_thread);
+  }
+
+  TEST(DynamicEpochAtom, Read) {
+    EpochAtom<ListType<int>> atom(list(1, 2, 3));
+    auto sum = read(atom, [](auto const& xs) {
+      int result = 0;
+      doList(xs, [&](int x) { result += x; });
+      return result;
+    });
+    ASSERT_EQ(sum, 6);
+  }
+
+  TEST(DynamicEpochAtom, Load) {
+    EpochAtom<ListType<int>> atom(list(1, 2, 3));
+    ASSERT_EQ(load(atom), list(1, 2, 3));
+  }
+
+  TEST(DynamicEpochAtom, Store) {
+    EpochAtom<ListType<int>> atom(list(1, 2, 3));
+    store(atom, list(4, 5));
+    ASSERT_EQ(load(atom), list(4, 5));
+  }
+
+  TEST(DynamicEpochAtom, Exchange) {
+    EpochAtom<ListType<int>> atom(list(1, 2, 3));
+    ASSERT_EQ(exchange(atom, list(4, 5)), list(1, 2, 3));
+    ASSERT_EQ(load(atom), list(4, 5));
+  }
+
+  TEST(DynamicEpochAtom, CompareExchange) {
+    EpochAtom<ListType<int>> atom(list(1, 2, 3));
+    auto expected = list(7);
+    ASSERT_FALSE(compareExchange(atom, expected, list(4, 5)));
+    ASSERT_EQ(expected, list(1, 2, 3));
+    ASSERT_TRUE(compareExchange(atom, expected, list(4, 5)));
+    ASSERT_EQ(load(atom), list(4, 5));
+  }
+
+  TEST(DynamicEpochAtom, RetiredSnapshotsAreReclaimed) {
+    auto tracker = std::make_shared<int>(0);
+    std::weak_ptr<int> weak = tracker;
+    {
+      EpochAtom<std::shared_ptr<int>> atom(tracker);
+      tracker.reset();
+      store(atom, std::make_shared<int>(1));
+    }
+    for (int i = 0; i < 4 && !weak.expired(); ++i) {
+      Epoch::collect();
+    }
+    ASSERT_TRUE(weak.expired());
+  }
+
+  TEST(DynamicEpochAtom, ConcurrentReadersAndWriters) {
+    constexpr int writer_count = 4;
+    constexpr int reader_count = 4;
+    constexpr int swaps_per_writer = 500;
+    EpochAtom<ListType<int>> atom;
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < reader_count; ++i) {
+      threads.emplace_back([&] {
+        while (!done) {
+          read(atom, [](auto const& xs) {
+            doList(xs, [](int x) { EXPECT_GE(x, 0); });
+            return 0;
+          });
+        }
+      });
+    }
+    std::vector<std::thread> writers;
+    for (int i = 0; i < writer_count; ++i) {
+      writers.emplace_back([&, i] {
+        for (int j = 0; j < swaps_per_writer; ++j) {
+          swap(atom, [=](auto xs) { return cons(i, xs); });
+        }
+      });
+    }
+    for (auto& writer : writers) {
+      writer.join();
+    }
+    done = true;
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    ASSERT_EQ(length(load(atom)), writer_count * swaps_per_writer);
+  }
+
+} // end of namespace ListProcessing::Testing
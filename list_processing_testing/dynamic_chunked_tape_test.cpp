@@ -0,0 +1,228 @@
+//
+// ... Standard header files
+//
+#include <any>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//
+// ... Testing header files
+//
+#include <gtest/gtest.h>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic_list.hpp>
+#include <list_processing/dynamic_tape.hpp>
+#include <list_processing/operators.hpp>
+
+using ListProcessing::Dynamic::ChunkedTape;
+using ListProcessing::Dynamic::chunkedTape;
+using ListProcessing::Dynamic::empty_chunked_tape;
+using ListProcessing::Dynamic::list;
+using ListProcessing::Dynamic::tape;
+
+namespace ListProcessing::Testing {
+
+  namespace {
+    ChunkedTape<int, 4>
+    iota(int n) {
+      std::vector<int> values(n);
+      for (int i = 0; i < n; ++i) {
+        values[i] = i;
+      }
+      return ChunkedTape<int, 4>(values);
+    }
+  } // end of anonymous namespace
+
+  TEST(ChunkedTape, ValuesConstructibleFromIterators) {
+    std::vector<std::any> values{};
+    for (int i = 0; i < 300; ++i) {
+      values.emplace_back(i);
+    }
+    ChunkedTape<std::any, 4> xs(values);
+    ASSERT_EQ(length(xs), 300);
+    xs = insert(std::any(-1), moveTo(2, xs));
+    xs = removeN(5, moveTo(100, xs));
+    ASSERT_EQ(length(xs), 296);
+    int expected[] = {0, 1, -1, 2};
+    xs = toFront(xs);
+    for (int i = 0; i < 296; ++i, xs = fwd(xs)) {
+      int x = std::any_cast<int>(read(xs));
+      ASSERT_EQ(x, i < 4 ? expected[i] : i < 100 ? i - 1 : i + 4);
+    }
+  }
+
+  TEST(ChunkedTape, EmptyTapeIsEmpty) {
+    ASSERT_TRUE(isEmpty(empty_chunked_tape<int>));
+    ASSERT_TRUE(isAtFront(empty_chunked_tape<int>));
+    ASSERT_TRUE(isAtBack(empty_chunked_tape<int>));
+    ASSERT_EQ(length(empty_chunked_tape<int>), 0);
+  }
+
+  TEST(ChunkedTape, Read) { ASSERT_EQ(read(chunkedTape(1, 2, 3)), 1); }
+
+  TEST(ChunkedTape, FObjRead) {
+    using namespace ListProcessing::Operators;
+    ASSERT_EQ(read(fwd(chunkedTape(1, 2, 3))), 2);
+  }
+
+  TEST(ChunkedTape, ReadAtBack) {
+    ASSERT_THROW(read(toBack(chunkedTape(1))), std::logic_error);
+  }
+
+  TEST(ChunkedTape, MoveOutside) {
+    ASSERT_THROW(bwd(chunkedTape(1)), std::logic_error);
+    ASSERT_THROW(fwd(fwd(chunkedTape(1))), std::logic_error);
+    ASSERT_THROW(moveTo(3, chunkedTape(1, 2)), std::logic_error);
+  }
+
+  TEST(ChunkedTape, Position) {
+    auto xs = iota(100);
+    ASSERT_EQ(position(xs), 0);
+    ASSERT_EQ(position(fwd(xs)), 1);
+    ASSERT_EQ(position(moveTo(57, xs)), 57);
+    ASSERT_EQ(remaining(moveTo(57, xs)), 43);
+    ASSERT_EQ(length(xs), 100);
+  }
+
+  TEST(ChunkedTape, MoveTo) {
+    auto xs = iota(1000);
+    for (int i = 0; i < 1000; i += 7) {
+      ASSERT_EQ(read(moveTo(i, xs)), i);
+    }
+  }
+
+  TEST(ChunkedTape, Walk) {
+    auto xs = iota(100);
+    for (int i = 0; i < 100; ++i, xs = fwd(xs)) {
+      ASSERT_EQ(read(xs), i);
+    }
+    ASSERT_TRUE(isAtBack(xs));
+    for (int i = 99; i >= 0; --i) {
+      xs = bwd(xs);
+      ASSERT_EQ(read(xs), i);
+    }
+    ASSERT_TRUE(isAtFront(xs));
+  }
+
+  TEST(ChunkedTape, Insert) {
+    auto xs = insert(0, fwd(chunkedTape(1, 2)));
+    ASSERT_EQ(read(xs), 0);
+    ASSERT_EQ(position(xs), 1);
+    ASSERT_EQ(toList(toFront(xs)), list(1, 0, 2));
+  }
+
+  TEST(ChunkedTape, InsertAtBack) {
+    ASSERT_EQ(
+      toList(toFront(insert(3, toBack(chunkedTape(1, 2))))), list(1, 2, 3));
+  }
+
+  TEST(ChunkedTape, Erase) {
+    ASSERT_EQ(erase(chunkedTape(1, 2, 3)), chunkedTape(2, 3));
+    ASSERT_EQ(erase(toBack(chunkedTape(1))), toBack(chunkedTape(1)));
+  }
+
+  TEST(ChunkedTape, Write) {
+    ASSERT_EQ(toList(write(fwd(chunkedTape(1, 2, 3)), 4)), list(4, 3));
+    ASSERT_EQ(toList(toFront(write(toBack(chunkedTape(1)), 2))), list(1, 2));
+  }
+
+  TEST(ChunkedTape, Persistence) {
+    auto xs = iota(10);
+    auto ys = write(moveTo(5, xs), 50);
+    ASSERT_EQ(read(moveTo(5, xs)), 5);
+    ASSERT_EQ(read(ys), 50);
+  }
+
+  TEST(ChunkedTape, Reverse) {
+    auto xs = reverse(moveTo(2, chunkedTape(1, 2, 3, 4)));
+    ASSERT_EQ(position(xs), 2);
+    ASSERT_EQ(read(xs), 2);
+    ASSERT_EQ(toList(toFront(xs)), list(4, 3, 2, 1));
+    ASSERT_EQ(reverse(xs), moveTo(2, chunkedTape(1, 2, 3, 4)));
+  }
+
+  TEST(ChunkedTape, ReverseInsertErase) {
+    auto xs = insert(9, reverse(moveTo(1, chunkedTape(1, 2, 3))));
+    ASSERT_EQ(toList(toFront(xs)), list(3, 2, 9, 1));
+    ASSERT_EQ(toList(toFront(erase(xs))), list(3, 2, 1));
+  }
+
+  TEST(ChunkedTape, Splice) {
+    auto xs = splice(fwd(chunkedTape(1, 2)), fwd(chunkedTape(3, 4)));
+    ASSERT_EQ(position(xs), 2);
+    ASSERT_EQ(toList(toFront(xs)), list(3, 1, 2, 4));
+  }
+
+  TEST(ChunkedTape, InsertRange) {
+    std::string text = "hello";
+    auto xs = insertRange(text, fwd(chunkedTape('<', '>')));
+    ASSERT_EQ(read(xs), 'h');
+    ASSERT_EQ(toList(toFront(xs)), list('<', 'h', 'e', 'l', 'l', 'o', '>'));
+    auto ys = insertRange(list(1, 2), reverse(fwd(chunkedTape(3, 4))));
+    ASSERT_EQ(toList(toFront(ys)), list(4, 1, 2, 3));
+  }
+
+  TEST(ChunkedTape, RemoveN) {
+    auto xs = removeN(50, moveTo(10, iota(100)));
+    ASSERT_EQ(length(xs), 50);
+    ASSERT_EQ(read(xs), 60);
+    ASSERT_EQ(read(bwd(xs)), 9);
+    ASSERT_EQ(removeN(2, reverse(moveTo(3, chunkedTape(1, 2, 3, 4)))),
+              reverse(moveTo(1, chunkedTape(1, 4))));
+  }
+
+  TEST(ChunkedTape, Extract) {
+    using namespace ListProcessing::Operators;
+    auto [xs, ys] = extract(3, moveTo(5, iota(10)));
+    ASSERT_EQ(xs, list(5, 6, 7));
+    ASSERT_EQ(toList(ys), list(8, 9));
+  }
+
+  TEST(ChunkedTape, AgreesWithTape) {
+    std::mt19937 gen(7);
+    auto xs = tape(0);
+    auto ys = chunkedTape(0);
+    for (int step = 0; step < 5000; ++step) {
+      switch (gen() % 6) {
+      case 0: xs = insert(step, xs); ys = insert(step, ys); break;
+      case 1: xs = erase(xs); ys = erase(ys); break;
+      case 2:
+        if (!isAtBack(xs)) {
+          xs = fwd(xs);
+          ys = fwd(ys);
+        }
+        break;
+      case 3:
+        if (!isAtFront(xs)) {
+          xs = bwd(xs);
+          ys = bwd(ys);
+        }
+        break;
+      case 4: xs = write(xs, -step); ys = write(ys, -step); break;
+      default: {
+        int index = int(gen() % (length(xs) + 1));
+        xs = moveTo(index, xs);
+        ys = moveTo(index, ys);
+      }
+      }
+      ASSERT_EQ(position(xs), position(ys));
+      ASSERT_EQ(length(xs), length(ys));
+      if (!isAtBack(xs)) {
+        ASSERT_EQ(read(xs), read(ys));
+      }
+    }
+    ASSERT_EQ(toList(toFront(xs)), toList(toFront(ys)));
+  }
+
+  TEST(ChunkedTape, Print) {
+    std::stringstream ss;
+    ss << fwd(chunkedTape(1, 2, 3));
+    ASSERT_EQ(ss.str(), "tape(...[2]...)");
+  }
+
+} // end of namespace ListProcessing::Testing
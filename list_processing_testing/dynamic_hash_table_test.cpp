@@ -3,6 +3,13 @@
 //
 #include <gtest/gtest.h>
 
+//
+// ... Standard header files
+//
+#include <cstddef>
+#include <stdexcept>
+#include <unordered_map>
+
 //
 // ... List Processing header files
 //
@@ -25,4 +32,83 @@ namespace ListProcessing::Dynamic::Testing {
     EXPECT_TRUE(hasData(HashTable<int, double>{{1, 2.3}, {3, 4.2}}));
   }
 
+  TEST(DynamicHashTable, SetGetRemove)
+  {
+    auto xs = HashTable<int, double>{}.set(1, 2.5).set(2, 3.5).set(1, 4.5);
+    EXPECT_EQ(length(xs), 2u);
+    EXPECT_EQ(tryGet(1, xs), 4.5);
+    EXPECT_EQ(forceGet(3, 0.0, xs), 0.0);
+    auto ys = remove(1, xs);
+    EXPECT_FALSE(hasKey(1, ys));
+    EXPECT_TRUE(hasKey(1, xs));
+    EXPECT_EQ(length(ys), 1u);
+    EXPECT_THROW(tryGet(1, ys), std::logic_error);
+  }
+
+  TEST(DynamicHashTable, AgreesWithUnorderedMap)
+  {
+    std::unordered_map<int, int> expected{};
+    HashTable<int, int> xs{};
+    for (int i = 0; i < 5000; ++i) {
+      int key = (i * 7919) % 3001;
+      if (i % 3 == 2) {
+        expected.erase(key);
+        xs = xs.remove(key);
+      } else {
+        expected[key] = i;
+        xs = xs.set(key, i);
+      }
+    }
+    EXPECT_EQ(xs.size(), expected.size());
+    for (int key = 0; key < 3001; ++key) {
+      auto position = expected.find(key);
+      EXPECT_EQ(
+        maybeGet(key, xs),
+        position == expected.end() ? std::optional<int>()
+                                   : std::optional<int>(position->second));
+    }
+  }
+
+  struct Colliding
+  {
+    int value;
+    friend bool
+    operator==(Colliding x, Colliding y)
+    {
+      return x.value == y.value;
+    }
+  };
+
+} // end of namespace ListProcessing::Dynamic::Testing
+
+template<>
+struct std::hash<ListProcessing::Dynamic::Testing::Colliding>
+{
+  std::size_t
+  operator()(ListProcessing::Dynamic::Testing::Colliding) const
+  {
+    return 42;
+  }
+};
+
+namespace ListProcessing::Dynamic::Testing {
+
+  TEST(DynamicHashTable, CollidingKeys)
+  {
+    HashTable<Colliding, int> xs{};
+    for (int i = 0; i < 10; ++i) {
+      xs = xs.set(Colliding{i}, i);
+    }
+    EXPECT_EQ(length(xs), 10u);
+    for (int i = 0; i < 10; ++i) {
+      EXPECT_EQ(tryGet(Colliding{i}, xs), i);
+    }
+    for (int i = 0; i < 10; i += 2) {
+      xs = xs.remove(Colliding{i});
+    }
+    EXPECT_EQ(length(xs), 5u);
+    EXPECT_FALSE(hasKey(Colliding{0}, xs));
+    EXPECT_EQ(tryGet(Colliding{9}, xs), 9);
+  }
+
 } // end of namespace ListProcessing::Dynamic::Testing
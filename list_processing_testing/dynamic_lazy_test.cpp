@@ -1,3 +1,13 @@
+//
+// ... Standard header files
+//
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
 //
 // ... Testing header files
 //
@@ -18,4 +28,55 @@ namespace ListProcessing::Dynamic::Testing {
     auto x = lazy([=]{ return 3; });
     EXPECT_TRUE(isLazy(x));
   }
+
+  TEST(DynamicLazy, Force){
+    int runs = 0;
+    auto x = lazy([&]{ ++runs; return 3; });
+    auto y = x;
+    EXPECT_EQ(force(x), 3);
+    EXPECT_TRUE(isReified(y));
+    EXPECT_EQ(static_cast<const int&>(y), 3);
+    EXPECT_EQ(runs, 1);
+    EXPECT_TRUE(isReified(Lazy<int>(4)));
+  }
+
+  TEST(DynamicLazy, ForcedOnceAcrossThreads){
+    std::atomic<int> runs{0};
+    auto x = lazy([&]{
+      ++runs;
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      return 42;
+    });
+    std::vector<std::thread> threads{};
+    std::atomic<int> total{0};
+    for (int i = 0; i < 8; ++i) {
+      threads.emplace_back([x, &total]{ total += force(x); });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    EXPECT_EQ(runs, 1);
+    EXPECT_EQ(total, 8 * 42);
+  }
+
+  TEST(DynamicLazy, FailedForceIsRetried){
+    int runs = 0;
+    auto x = lazy([&]{
+      if (++runs == 1) {
+        throw std::runtime_error("first");
+      }
+      return 5;
+    });
+    EXPECT_THROW(force(x), std::runtime_error);
+    EXPECT_TRUE(isLazy(x));
+    EXPECT_EQ(force(x), 5);
+  }
+
+  TEST(DynamicLazy, ThunkIsReleased){
+    auto captured = std::make_shared<int>(7);
+    auto x = lazy([captured]{ return *captured; });
+    EXPECT_EQ(captured.use_count(), 2);
+    EXPECT_EQ(force(x), 7);
+    EXPECT_EQ(captured.use_count(), 1);
+  }
 }
@@ -2,6 +2,7 @@
 // ... Standard header files
 //
 #include <functional>
+#include <limits>
 #include <string>
 
 //
@@ -28,6 +29,7 @@ using FunctionUtility::curry;
 using ListProcessing::Dynamic::buildList;
 using ListProcessing::Dynamic::list;
 using ListProcessing::Dynamic::ListType;
+using ListProcessing::Dynamic::literal;
 using ListProcessing::Dynamic::nil;
 using ListProcessing::Dynamic::Nil;
 using ListProcessing::Dynamic::size_type;
@@ -66,6 +68,12 @@ namespace ListProcessing::Testing {
 
   TEST(DynamicList, InequalityXY) { ASSERT_TRUE(list(1) != list(2)); }
 
+  TEST(DynamicList, EqualityNaN) {
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    auto xs = List<double, 1>(nan, List<double, 1>());
+    ASSERT_FALSE(xs == xs);
+  }
+
   TEST(DynamicList, NilIsNull) { ASSERT_TRUE(isNull(nil<int>)); }
 
   TEST(DynamicList, LengthNilIs0) { ASSERT_EQ(length(nil<int>), 0); }
@@ -137,6 +145,18 @@ namespace ListProcessing::Testing {
 
   TEST(DynamicList, Drop3Of2) { ASSERT_EQ(drop(list(1, 2), 3), nil<int>); }
 
+  TEST(DynamicList, ChunkedTakeDropAppend) {
+    auto xs = buildList([](auto i) { return int(i); }, 100);
+    auto ys = buildList([](auto i) { return int(i) + 70; }, 30);
+    auto zs = buildList([](auto i) { return int(i); }, 70);
+    ASSERT_EQ(take(xs, 70), zs);
+    ASSERT_EQ(drop(xs, 70), ys);
+    ASSERT_EQ(append(take(xs, 70), drop(xs, 70)), xs);
+    ASSERT_EQ(length(append(xs, xs)), 200);
+    ASSERT_EQ(take(xs, 1000), xs);
+    ASSERT_EQ(drop(xs, 1000), nil<int>);
+  }
+
   TEST(DynamicList, FoldL) {
     auto xs = foldL([](auto x, auto y) { return x + y; }, 0, list(1, 2, 3));
     ASSERT_EQ(xs, 6);
@@ -267,4 +287,17 @@ namespace ListProcessing::Testing {
   }
 
   TEST(DynamicList, GenericNil) { ASSERT_EQ(cons(1, Nil{}), list(1)); }
+
+  TEST(DynamicList, Literal) {
+    auto xs = literal<1, 2, 3>();
+    auto ys = literal<1, 2, 3>();
+    ASSERT_EQ(xs, list(1, 2, 3));
+    ASSERT_EQ(&xs.head(), &ys.head());
+  }
+
+  TEST(DynamicList, ConsOntoLiteral) {
+    auto xs = literal<'b', 'c'>();
+    ASSERT_EQ(cons('a', xs), list('a', 'b', 'c'));
+    ASSERT_EQ(xs, list('b', 'c'));
+  }
 } // end of namespace ListProcessing::Testing
@@ -0,0 +1,97 @@
+//
+// ... Standard header files
+//
+#include <utility>
+
+//
+// ... Testing header files
+//
+#include <gtest/gtest.h>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/compile_time.hpp>
+#include <list_processing/compile_time_alist.hpp>
+#include <list_processing/dynamic.hpp>
+#include <list_processing/dynamic_alist.hpp>
+#include <list_processing/dynamic_lowering.hpp>
+
+using std::pair;
+
+using ListProcessing::Dynamic::list;
+using ListProcessing::Dynamic::lowerAList;
+using ListProcessing::Dynamic::lowerList;
+
+namespace CT = ListProcessing::CompileTime;
+
+namespace {
+
+  constexpr auto ints = CT::list(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11);
+  constexpr auto flat_ints = CT::flatList(1, 2, 3);
+  constexpr auto nothing = CT::list();
+  constexpr auto stack = CT::make_stack(pair(1, 'a'), pair(2, 'b'));
+  constexpr auto queue = push(3.0, CT::makeQueue(1.0, 2.0));
+  constexpr auto routes =
+    CT::alist(pair(CT::idx<1>, 'a'), pair(CT::idx<2>, 'b'));
+
+} // end of anonymous namespace
+
+namespace ListProcessing::Testing {
+
+  TEST(Lowering, List)
+  {
+    auto xs = lowerList<ints>();
+    ASSERT_EQ(xs, list(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11));
+    ASSERT_EQ(length(xs), 11);
+  }
+
+  TEST(Lowering, ListIsShared)
+  {
+    ASSERT_EQ(&lowerList<ints>().head(), &lowerList<ints>().head());
+  }
+
+  TEST(Lowering, ConsOntoLoweredList)
+  {
+    auto xs = lowerList<ints>();
+    auto ys = cons(0, xs);
+    auto zs = cons(-1, xs);
+    ASSERT_EQ(head(ys), 0);
+    ASSERT_EQ(head(zs), -1);
+    ASSERT_EQ(tail(ys), xs);
+    ASSERT_EQ(tail(zs), xs);
+    ASSERT_EQ(lowerList<ints>(), list(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11));
+  }
+
+  TEST(Lowering, FlatList)
+  {
+    ASSERT_EQ(lowerList<flat_ints>(), list(1, 2, 3));
+  }
+
+  TEST(Lowering, EmptyList)
+  {
+    ASSERT_TRUE(isEmpty(lowerList<nothing, int>()));
+  }
+
+  TEST(Lowering, Stack)
+  {
+    auto xs = lowerList<stack>();
+    ASSERT_EQ(head(xs), pair(1, 'a'));
+    ASSERT_EQ(head(tail(xs)), pair(2, 'b'));
+    ASSERT_TRUE(isEmpty(tail(tail(xs))));
+  }
+
+  TEST(Lowering, Queue)
+  {
+    ASSERT_EQ(lowerList<queue>(), list(1.0, 2.0, 3.0));
+  }
+
+  TEST(Lowering, AList)
+  {
+    auto xs = lowerAList<routes, long, char>();
+    ASSERT_EQ(xs.tryGet(1), 'a');
+    ASSERT_EQ(xs.tryGet(2), 'b');
+    ASSERT_FALSE(xs.hasKey(3));
+  }
+
+} // end of namespace ListProcessing::Testing
@@ -0,0 +1,148 @@
+//
+// ... Standard header files
+//
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+//
+// ... Testing header files
+//
+#include <gtest/gtest.h>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic_memo.hpp>
+
+using ListProcessing::Dynamic::EvictionPolicy;
+using ListProcessing::Dynamic::memoize;
+
+namespace ListProcessing::Testing {
+
+  TEST(Memoize, ResultsAreCached)
+  {
+    int calls = 0;
+    auto square = memoize<int>([&](int x) { ++calls; return x * x; }, 8);
+    ASSERT_EQ(square(3), 9);
+    ASSERT_EQ(square(3), 9);
+    ASSERT_EQ(square(4), 16);
+    ASSERT_EQ(calls, 2);
+    auto stats = statistics(square);
+    ASSERT_EQ(stats.hits, 1);
+    ASSERT_EQ(stats.misses, 2);
+    ASSERT_EQ(size(square), 2);
+  }
+
+  TEST(Memoize, LookupIsLazy)
+  {
+    int calls = 0;
+    auto length = memoize<std::string>(
+      [&](std::string const& s) { ++calls; return s.size(); }, 8);
+    auto x = length.lookup("abc");
+    ASSERT_TRUE(isLazy(x));
+    ASSERT_EQ(calls, 0);
+    ASSERT_EQ(length("abc"), 3);
+    ASSERT_TRUE(isReified(x));
+    ASSERT_EQ(calls, 1);
+  }
+
+  TEST(Memoize, LeastRecentlyUsedIsEvicted)
+  {
+    int calls = 0;
+    auto f = memoize<int>([&](int x) { ++calls; return x; }, 2);
+    f(1);
+    f(2);
+    f(1);
+    f(3);
+    ASSERT_EQ(statistics(f).evictions, 1);
+    f(1);
+    ASSERT_EQ(calls, 3);
+    f(2);
+    ASSERT_EQ(calls, 4);
+  }
+
+  TEST(Memoize, ClockGivesReferencedEntriesASecondChance)
+  {
+    int calls = 0;
+    auto f =
+      memoize<int>([&](int x) { ++calls; return x; }, 2, EvictionPolicy::clock);
+    f(1);
+    f(2);
+    f(3);
+    f(3);
+    ASSERT_EQ(calls, 3);
+    ASSERT_EQ(size(f), 2);
+    ASSERT_EQ(statistics(f).evictions, 1);
+  }
+
+  TEST(Memoize, TinyLfuKeepsFrequentKeys)
+  {
+    int calls = 0;
+    auto f = memoize<int>(
+      [&](int x) { ++calls; return x; }, 2, EvictionPolicy::tinyLfu);
+    for (int i = 0; i < 5; ++i) {
+      f(1);
+      f(2);
+    }
+    for (int i = 100; i < 200; ++i) {
+      f(i);
+    }
+    calls = 0;
+    f(1);
+    f(2);
+    ASSERT_EQ(calls, 0);
+  }
+
+  TEST(Memoize, ConcurrentCallsShareOneComputation)
+  {
+    std::atomic<int> calls{0};
+    auto f = memoize<int>(
+      [&](int x) {
+        ++calls;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        return x + 1;
+      },
+      1024);
+    std::vector<std::thread> threads{};
+    for (int i = 0; i < 8; ++i) {
+      threads.emplace_back([f] {
+        for (int k = 0; k < 4; ++k) {
+          ASSERT_EQ(f(k), k + 1);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    ASSERT_EQ(calls, 4);
+    ASSERT_EQ(statistics(f).hits + statistics(f).misses, 32);
+  }
+
+  TEST(Memoize, IntegerKeysFillEveryShard)
+  {
+    auto identity = memoize<int>([](int x) { return x; }, 1024);
+    for (int i = 0; i < 8 * 1024; ++i) {
+      identity(i);
+    }
+    ASSERT_EQ(size(identity), 1024);
+  }
+
+  TEST(Memoize, UnevenCapacityIsABound)
+  {
+    auto identity = memoize<int>([](int x) { return x; }, 300);
+    for (int i = 0; i < 8 * 300; ++i) {
+      identity(i);
+    }
+    ASSERT_EQ(size(identity), 300);
+  }
+
+  TEST(Memoize, CapacityMustBePositive)
+  {
+    ASSERT_THROW(memoize<int>([](int x) { return x; }, 0), std::logic_error);
+  }
+
+} // end of namespace ListProcessing::Testing
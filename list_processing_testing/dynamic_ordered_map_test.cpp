@@ -0,0 +1,164 @@
+//
+// ... Standard header files
+//
+#include <map>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+//
+// ... Testing header files
+//
+#include <gtest/gtest.h>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic_alist.hpp>
+#include <list_processing/dynamic_list.hpp>
+#include <list_processing/dynamic_ordered_map.hpp>
+#include <list_processing/operators.hpp>
+
+using std::nullopt;
+using std::optional;
+using std::pair;
+
+using ListProcessing::Dynamic::alist;
+using ListProcessing::Dynamic::empty_ordered_map;
+using ListProcessing::Dynamic::list;
+using ListProcessing::Dynamic::OrderedMap;
+using ListProcessing::Dynamic::orderedMap;
+
+namespace ListProcessing::Testing {
+
+  namespace {
+    OrderedMap<int, int>
+    squares(int n) {
+      auto xs = empty_ordered_map<int, int>;
+      for (int i = 0; i < n; ++i) {
+        xs = set(i, i * i, xs);
+      }
+      return xs;
+    }
+  } // end of anonymous namespace
+
+  TEST(DynamicOrderedMap, EmptyMapIsEmpty) {
+    ASSERT_TRUE(isEmpty(empty_ordered_map<int, int>));
+    ASSERT_FALSE(hasData(empty_ordered_map<int, int>));
+    ASSERT_EQ(length(empty_ordered_map<int, int>), 0);
+  }
+
+  TEST(DynamicOrderedMap, Set) {
+    auto xs = set(2, 'b', set(1, 'a', empty_ordered_map<int, char>));
+    ASSERT_EQ(length(xs), 2);
+    ASSERT_EQ(tryGet(1, xs), 'a');
+    ASSERT_EQ(tryGet(2, xs), 'b');
+  }
+
+  TEST(DynamicOrderedMap, SetReplaces) {
+    auto xs = set(1, 'b', set(1, 'a', empty_ordered_map<int, char>));
+    ASSERT_EQ(length(xs), 1);
+    ASSERT_EQ(tryGet(1, xs), 'b');
+  }
+
+  TEST(DynamicOrderedMap, FObjSet) {
+    using namespace ListProcessing::Operators;
+    auto xs = set(1, 'a', empty_ordered_map<int, char>);
+    ASSERT_TRUE(hasKey(1, xs));
+    ASSERT_EQ(maybeGet(1, xs), optional<char>('a'));
+    ASSERT_EQ(forceGet(2, 'z', xs), 'z');
+  }
+
+  TEST(DynamicOrderedMap, Lookup) {
+    auto xs = squares(100);
+    ASSERT_TRUE(hasKey(50, xs));
+    ASSERT_FALSE(hasKey(100, xs));
+    ASSERT_EQ(maybeGet(7, xs), optional<int>(49));
+    ASSERT_EQ(maybeGet(-1, xs), nullopt);
+    ASSERT_EQ(forceGet(9, 0, xs), 81);
+    ASSERT_EQ(forceGet(200, -1, xs), -1);
+    ASSERT_THROW(tryGet(200, xs), std::logic_error);
+  }
+
+  TEST(DynamicOrderedMap, Unset) {
+    auto xs = squares(10);
+    auto ys = unset(5, xs);
+    ASSERT_FALSE(hasKey(5, ys));
+    ASSERT_EQ(length(ys), 9);
+    ASSERT_TRUE(hasKey(5, xs));
+    ASSERT_EQ(unset(42, xs), xs);
+    ASSERT_EQ(remove(3, xs), unset(3, xs));
+  }
+
+  TEST(DynamicOrderedMap, OrderedIteration) {
+    auto xs = orderedMap(
+      pair(3, 'c'), pair(1, 'a'), pair(2, 'b'), pair(1, 'z'));
+    ASSERT_EQ(keys(xs), list(1, 2, 3));
+    ASSERT_EQ(vals(xs), list('a', 'b', 'c'));
+    auto expected = list(pair(1, 'a'), pair(2, 'b'), pair(3, 'c'));
+    ASSERT_EQ(toList(xs), expected);
+  }
+
+  TEST(DynamicOrderedMap, FromAList) {
+    auto xs = OrderedMap<int, char>(
+      alist(pair(2, 'b'), pair(1, 'a'), pair(2, 'x')));
+    ASSERT_EQ(length(xs), 2);
+    ASSERT_EQ(tryGet(2, xs), 'b');
+  }
+
+  TEST(DynamicOrderedMap, Bounds) {
+    auto xs = orderedMap(pair(10, 'a'), pair(20, 'b'), pair(30, 'c'));
+    ASSERT_EQ(xs.min(), pair(10, 'a'));
+    ASSERT_EQ(xs.max(), pair(30, 'c'));
+    ASSERT_EQ(xs.lowerBound(20), pair(20, 'b'));
+    ASSERT_EQ(xs.lowerBound(21), pair(30, 'c'));
+    ASSERT_EQ(xs.upperBound(20), pair(30, 'c'));
+    ASSERT_EQ(xs.upperBound(30), nullopt);
+    ASSERT_EQ((empty_ordered_map<int, char>.min()), nullopt);
+  }
+
+  TEST(DynamicOrderedMap, Range) {
+    auto xs = squares(100);
+    ASSERT_EQ(keys(range(10, 15, xs)), list(10, 11, 12, 13, 14));
+    ASSERT_EQ(keys(range(-5, 2, xs)), list(0, 1));
+    ASSERT_TRUE(isEmpty(range(15, 10, xs)));
+    ASSERT_EQ(length(range(0, 1000, xs)), 100);
+  }
+
+  TEST(DynamicOrderedMap, SplitJoin) {
+    auto xs = squares(100);
+    auto [below, found, above] = split(40, xs);
+    ASSERT_EQ(length(below), 40);
+    ASSERT_EQ(found, optional<int>(1600));
+    ASSERT_EQ(length(above), 59);
+    ASSERT_EQ(join(below, set(40, 1600, above)), xs);
+    ASSERT_EQ(join(below, above), unset(40, xs));
+    ASSERT_THROW(join(above, below), std::logic_error);
+    ASSERT_THROW(join(xs, set(99, 0, above)), std::logic_error);
+    ASSERT_EQ(join(xs, empty_ordered_map<int, int>), xs);
+  }
+
+  TEST(DynamicOrderedMap, AgreesWithStdMap) {
+    std::mt19937 gen(11);
+    std::map<int, int> expected{};
+    auto xs = empty_ordered_map<int, int>;
+    for (int step = 0; step < 20000; ++step) {
+      int key = int(gen() % 1000);
+      if (gen() % 3 == 0) {
+        expected.erase(key);
+        xs = unset(key, xs);
+      } else {
+        expected[key] = step;
+        xs = set(key, step, xs);
+      }
+    }
+    ASSERT_EQ(length(xs), expected.size());
+    auto entry = expected.begin();
+    doEntries(xs, [&](pair<int, int> const& assoc) {
+      ASSERT_EQ(assoc, (pair<int, int>(*entry)));
+      ++entry;
+    });
+  }
+
+} // end of namespace ListProcessing::Testing
@@ -0,0 +1,133 @@
+//
+// ... Standard header files
+//
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+//
+// ... Testing header files
+//
+#include <gtest/gtest.h>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic_list.hpp>
+#include <list_processing/dynamic_parallel.hpp>
+
+using ListProcessing::Dynamic::buildList;
+using ListProcessing::Dynamic::list;
+using ListProcessing::Dynamic::nil;
+using ListProcessing::Dynamic::parallelFilter;
+using ListProcessing::Dynamic::parallelMap;
+using ListProcessing::Dynamic::parallelReduce;
+using ListProcessing::Dynamic::size_type;
+using ListProcessing::Dynamic::ThreadPool;
+using ListProcessing::Dynamic::Details::List;
+
+namespace ListProcessing::Testing {
+
+  TEST(DynamicThreadPool, ParallelForCallsEachIndexOnce) {
+    ThreadPool pool(4);
+    std::vector<std::atomic<int>> counts(1000);
+    pool.parallelFor(1000, [&](auto i) { ++counts[i]; });
+    for (auto& count : counts) {
+      ASSERT_EQ(count, 1);
+    }
+  }
+
+  TEST(DynamicThreadPool, NestedParallelFor) {
+    ThreadPool pool(2);
+    std::atomic<int> count{0};
+    pool.parallelFor(
+      8, [&](auto) { pool.parallelFor(8, [&](auto) { ++count; }); });
+    ASSERT_EQ(count, 64);
+  }
+
+  TEST(DynamicThreadPool, ParallelForRethrows) {
+    ThreadPool pool(2);
+    ASSERT_THROW(
+      pool.parallelFor(
+        16,
+        [](auto i) {
+          if (i == 7) {
+            throw std::runtime_error("failed");
+          }
+        }),
+      std::runtime_error);
+  }
+
+  TEST(DynamicParallel, MapEmpty) {
+    ASSERT_EQ(parallelMap([](int x) { return x + 1; }, nil<int>), nil<int>);
+  }
+
+  TEST(DynamicParallel, MapSmall) {
+    ASSERT_EQ(
+      parallelMap([](int x) { return x * x; }, list(1, 2, 3)), list(1, 4, 9));
+  }
+
+  TEST(DynamicParallel, MapBigList) {
+    constexpr size_type n = 100'000;
+    auto xs = buildList([](auto i) { return i; }, n);
+    auto ys = parallelMap([](auto x) { return 2 * x; }, xs, 1000);
+    ASSERT_EQ(ys, map([](auto x) { return 2 * x; }, xs));
+  }
+
+  TEST(DynamicParallel, MapReferenceList) {
+    auto xs = list(std::string("a"), std::string("b"), std::string("c"));
+    auto ys = parallelMap([](auto const& x) { return x + x; }, xs, 1);
+    ASSERT_EQ(ys, list(std::string("aa"), std::string("bb"), std::string("cc")));
+  }
+
+  TEST(DynamicParallel, MapChangesChunking) {
+    auto xs = List<int, 1>(1, List<int, 1>(2, List<int, 1>()));
+    ASSERT_EQ(parallelMap([](int x) { return x + 1; }, xs), list(2, 3));
+  }
+
+  TEST(DynamicParallel, ReduceEmpty) {
+    ASSERT_EQ(parallelReduce([](int x, int y) { return x + y; }, 7, nil<int>), 7);
+  }
+
+  TEST(DynamicParallel, ReduceBigList) {
+    constexpr size_type n = 100'000;
+    auto xs = buildList([](auto i) { return i; }, n);
+    ASSERT_EQ(
+      parallelReduce([](auto x, auto y) { return x + y; }, size_type(0), xs, 1000),
+      n * (n - 1) / 2);
+  }
+
+  TEST(DynamicParallel, ReducePreservesOrder) {
+    auto xs = parallelMap(
+      [](int x) { return std::to_string(x % 10); },
+      buildList([](auto i) { return int(i); }, 1000));
+    std::string expected{};
+    doList(xs, [&](auto const& x) { expected += x; });
+    ASSERT_EQ(
+      parallelReduce(
+        [](auto const& x, auto const& y) { return x + y; },
+        std::string{},
+        xs,
+        10),
+      expected);
+  }
+
+  TEST(DynamicParallel, FilterBigList) {
+    constexpr size_type n = 100'000;
+    auto xs = buildList([](auto i) { return i; }, n);
+    auto ys = parallelFilter([](auto x) { return x % 3 == 0; }, xs, 1000);
+    ASSERT_EQ(length(ys), (n + 2) / 3);
+    size_type expected = 0;
+    doList(ys, [&](auto x) {
+      ASSERT_EQ(x, expected);
+      expected += 3;
+    });
+  }
+
+  TEST(DynamicParallel, FilterNone) {
+    auto xs = buildList([](auto i) { return i; }, 1000);
+    ASSERT_EQ(
+      length(parallelFilter([](auto) { return false; }, xs, 10)), 0);
+  }
+
+} // end of namespace ListProcessing::Testing
@@ -0,0 +1,130 @@
+//
+// ... Standard header files
+//
+#include <optional>
+#include <string>
+#include <utility>
+
+//
+// ... Testing header files
+//
+#include <gtest/gtest.h>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic_alist.hpp>
+#include <list_processing/dynamic_list.hpp>
+#include <list_processing/dynamic_stream.hpp>
+#include <list_processing/operators.hpp>
+
+using namespace std::literals::string_literals;
+using std::nullopt;
+using std::optional;
+using std::pair;
+using std::string;
+
+namespace ListProcessing::Dynamic::Testing {
+  namespace // anonymous
+  {
+    constexpr auto parity = [](int x) { return x % 2; };
+    constexpr auto length_of = [](string const& x) { return x.size(); };
+
+  } // end of anonymous namespace
+
+  TEST(DynamicRelational, GroupBy) {
+    auto groups = list(1, 2, 3, 4, 5).groupBy(parity);
+    ASSERT_EQ(keys(groups), list(1, 0));
+    ASSERT_EQ(tryGet(1, groups), list(1, 3, 5));
+    ASSERT_EQ(tryGet(0, groups), list(2, 4));
+  }
+
+  TEST(DynamicRelational, GroupByEmpty) {
+    ASSERT_TRUE(isEmpty(nil<int>.groupBy(parity)));
+  }
+
+  TEST(DynamicRelational, GroupByOperator) {
+    auto groups =
+      ListProcessing::Operators::groupBy(length_of, list("a"s, "bc"s, "d"s));
+    ASSERT_EQ(tryGet(1, groups), list("a"s, "d"s));
+    ASSERT_EQ(tryGet(2, groups), list("bc"s));
+  }
+
+  TEST(DynamicRelational, CountBy) {
+    auto counts = list(1, 2, 3, 4, 5).countBy(parity);
+    ASSERT_EQ(tryGet(1, counts), 3);
+    ASSERT_EQ(tryGet(0, counts), 2);
+  }
+
+  TEST(DynamicRelational, Distinct) {
+    ASSERT_EQ(list(3, 1, 3, 2, 1).distinct(), list(3, 1, 2));
+  }
+
+  TEST(DynamicRelational, DistinctOperator) {
+    ASSERT_EQ(
+      ListProcessing::Operators::distinct(list("a"s, "b"s, "a"s)),
+      list("a"s, "b"s));
+  }
+
+  TEST(DynamicRelational, InnerJoin) {
+    using Result = pair<int, string>;
+    auto ys = list("one"s, "two"s, "three"s, "four"s);
+    auto key = [](auto const& x) {
+      if constexpr (std::is_same_v<std::decay_t<decltype(x)>, string>) {
+        return int(x.size());
+      } else {
+        return x;
+      }
+    };
+    ASSERT_EQ(
+      list(3, 5, 2).innerJoin(key, ys),
+      list(Result{3, "one"s}, Result{3, "two"s}, Result{5, "three"s}));
+  }
+
+  TEST(DynamicRelational, LeftJoin) {
+    using Result = pair<int, optional<int>>;
+    ASSERT_EQ(
+      list(1, 2, 3).leftJoin([](int x) { return x % 2; }, list(11, 13)),
+      list(Result{1, 11}, Result{1, 13}, Result{2, nullopt}, Result{3, 11},
+           Result{3, 13}));
+  }
+
+  TEST(DynamicRelational, JoinOperator) {
+    using Result = pair<int, int>;
+    ASSERT_EQ(
+      ListProcessing::Operators::innerJoin(parity, list(10, 11), list(1, 2)),
+      list(Result{1, 11}, Result{2, 10}));
+  }
+
+  TEST(DynamicRelational, StreamGroupBy) {
+    auto groups =
+      buildStream(5, [](auto i) { return int(i) + 1; }).groupBy(parity);
+    ASSERT_EQ(tryGet(1, groups), list(1, 3, 5));
+  }
+
+  TEST(DynamicRelational, StreamDistinctIsLazy) {
+    auto xs = streamIterate(0, [](int x) { return (x + 1) % 3; }).distinct();
+    ASSERT_EQ(*streamRef(0, xs), 0);
+    ASSERT_EQ(*streamRef(1, xs), 1);
+    ASSERT_EQ(*streamRef(2, xs), 2);
+  }
+
+  TEST(DynamicRelational, StreamInnerJoinIsLazy) {
+    using Result = pair<int, int>;
+    auto xs = streamIterate(0, [](int x) { return x + 1; })
+                .innerJoin([](int x) { return x % 4; }, list(1, 3));
+    ASSERT_EQ(*streamRef(0, xs), (Result{1, 1}));
+    ASSERT_EQ(*streamRef(1, xs), (Result{3, 3}));
+    ASSERT_EQ(*streamRef(2, xs), (Result{5, 1}));
+  }
+
+  TEST(DynamicRelational, StreamLeftJoin) {
+    using Result = pair<int, optional<int>>;
+    auto xs = buildStream(3, [](auto i) { return int(i); })
+                .leftJoin([](int x) { return x; }, list(1));
+    ASSERT_EQ(
+      xs.toList(),
+      list(Result{0, nullopt}, Result{1, 1}, Result{2, nullopt}));
+  }
+
+} // end of namespace ListProcessing::Dynamic::Testing
@@ -0,0 +1,241 @@
+//
+// ... Standard header files
+//
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+//
+// ... Testing header files
+//
+#include <gtest/gtest.h>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic.hpp>
+#include <list_processing/dynamic_alist.hpp>
+#include <list_processing/dynamic_queue.hpp>
+#include <list_processing/dynamic_serialization.hpp>
+#include <list_processing/dynamic_shared_list.hpp>
+#include <list_processing/dynamic_stack.hpp>
+#include <list_processing/dynamic_tape.hpp>
+#include <list_processing/dynamic_tlist.hpp>
+#include <list_processing/dynamic_tree.hpp>
+
+using std::pair;
+using std::string;
+
+using ListProcessing::Dynamic::alist;
+using ListProcessing::Dynamic::Details::AList;
+using ListProcessing::Dynamic::Arena;
+using ListProcessing::Dynamic::branch_close;
+using ListProcessing::Dynamic::branch_open;
+using ListProcessing::Dynamic::buildTree;
+using ListProcessing::Dynamic::Construct;
+using ListProcessing::Dynamic::Decoder;
+using ListProcessing::Dynamic::deserialize;
+using ListProcessing::Dynamic::empty_stack;
+using ListProcessing::Dynamic::Encoder;
+using ListProcessing::Dynamic::list;
+using ListProcessing::Dynamic::ListType;
+using ListProcessing::Dynamic::queue;
+using ListProcessing::Dynamic::Details::Queue;
+using ListProcessing::Dynamic::serialize;
+using ListProcessing::Dynamic::Shared;
+using ListProcessing::Dynamic::Stack;
+using ListProcessing::Dynamic::tape;
+using ListProcessing::Dynamic::Details::Tape;
+using ListProcessing::Dynamic::tlist;
+using ListProcessing::Dynamic::Tree;
+using ListProcessing::Dynamic::TreeToken;
+
+namespace ListProcessing::Testing {
+
+  using Words = ListType<string>;
+
+  TEST(Serialization, List)
+  {
+    Words xs = list(string("a"), string("bc"), string(""));
+    ASSERT_EQ(deserialize<Words>(serialize(xs)), xs);
+    ASSERT_EQ(deserialize<Words>(serialize(Words{})), Words{});
+  }
+
+  TEST(Serialization, ChunkedList)
+  {
+    ListType<int> xs = list(1, -2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13);
+    ASSERT_EQ(deserialize<ListType<int>>(serialize(xs)), xs);
+  }
+
+  TEST(Serialization, Doubles)
+  {
+    ListType<double> xs = list(0.5, -1.25e300, 3.0);
+    ASSERT_EQ(deserialize<ListType<double>>(serialize(xs)), xs);
+  }
+
+  TEST(Serialization, SharedTailIsWrittenOnce)
+  {
+    Words tail = list(
+      string("one"), string("two"), string("three"), string("four"));
+    auto xs = cons(string("x"), tail);
+    auto ys = cons(string("y"), tail);
+    using Both = pair<Words, Words>;
+    string both = serialize(Both(xs, ys));
+    ASSERT_LT(both.size(), 2 * serialize(xs).size() - 1);
+
+    auto [us, vs] = deserialize<Both>(both);
+    ASSERT_EQ(us, xs);
+    ASSERT_EQ(vs, ys);
+    ASSERT_EQ(&us.tail().head(), &vs.tail().head());
+  }
+
+  TEST(Serialization, ValuesShareAcrossOneEncoder)
+  {
+    Words tail = list(string("a"), string("b"));
+    Encoder out{};
+    out.encode(cons(string("x"), tail));
+    out.encode(cons(string("y"), tail));
+
+    Decoder in(out.bytes());
+    auto xs = in.decode<Words>();
+    auto ys = in.decode<Words>();
+    ASSERT_TRUE(in.isAtEnd());
+    ASSERT_EQ(ys, cons(string("y"), tail));
+    ASSERT_EQ(&xs.tail().head(), &ys.tail().head());
+  }
+
+  TEST(Serialization, NodesComeFromTheArena)
+  {
+    auto arena = std::make_shared<Arena>();
+    Words xs = list(string("a"), string("b"));
+    auto ys = deserialize<Words>(serialize(xs), arena);
+    ASSERT_EQ(ys, xs);
+    ASSERT_GT(arena->reserved(), 0);
+    arena.reset();
+    ASSERT_EQ(ys, xs);
+  }
+
+  TEST(Serialization, Containers)
+  {
+    using Names = AList<int, string>;
+    Names xs = alist(pair(1, string("one")), pair(2, string("two")));
+    auto ys = deserialize<Names>(serialize(xs));
+    ASSERT_EQ(tryGet(1, ys), "one");
+    ASSERT_EQ(tryGet(2, ys), "two");
+
+    Queue<int> q = pop(push(4, queue(1, 2, 3)));
+    ASSERT_EQ(deserialize<Queue<int>>(serialize(q)), q);
+
+    Tape<char> t = fwd(tape('a', 'b', 'c'));
+    auto u = deserialize<Tape<char>>(serialize(t));
+    ASSERT_EQ(u, t);
+    ASSERT_EQ(read(u), 'b');
+
+    Stack<int> s = push(2, push(1, empty_stack<int>));
+    ASSERT_EQ(deserialize<Stack<int>>(serialize(s)), s);
+  }
+
+  TEST(Serialization, Tree)
+  {
+    std::vector<TreeToken<int>> tokens{
+      1, branch_open, 2, branch_open, 3, branch_close, branch_close, 4};
+    auto xs = buildTree(tokens);
+    auto ys = deserialize<Tree<int>>(serialize(xs));
+    ASSERT_EQ(length(ys), length(xs));
+    ASSERT_EQ(read(ys), 1);
+    ASSERT_EQ(read(open(fwd(ys))), 2);
+    ASSERT_EQ(read(open(fwd(open(fwd(ys))))), 3);
+    ASSERT_EQ(read(fwd(fwd(ys))), 4);
+  }
+
+  TEST(Serialization, TreeBranchesAreShared)
+  {
+    std::vector<TreeToken<int>> tokens{
+      1, branch_open, 2, 3, 4, 5, 6, 7, 8, branch_close};
+    auto xs = buildTree(tokens);
+    auto ys = write(xs, 9);
+    using Both = pair<Tree<int>, Tree<int>>;
+    ASSERT_LT(serialize(Both(xs, ys)).size(), 2 * serialize(xs).size() - 1);
+
+    auto [us, vs] = deserialize<Both>(serialize(Both(xs, ys)));
+    ASSERT_EQ(read(us), 1);
+    ASSERT_EQ(read(vs), 9);
+    ASSERT_EQ(read(open(fwd(vs))), 2);
+  }
+
+  TEST(Serialization, DeepTree)
+  {
+    constexpr int depth = 1000000;
+    std::vector<TreeToken<int>> tokens{};
+    for (int i = 0; i < depth; ++i) {
+      tokens.emplace_back(i);
+      tokens.emplace_back(branch_open);
+    }
+    tokens.insert(tokens.end(), depth, branch_close);
+    auto xs = buildTree(tokens);
+    auto ys = deserialize<Tree<int>>(serialize(xs));
+    ASSERT_EQ(length(ys), 2 * depth);
+    ASSERT_EQ(read(ys), 0);
+    ASSERT_EQ(read(open(fwd(ys))), 1);
+    auto plus = [](long x, long y) { return x + y; };
+    ASSERT_EQ(ys.parallelReduce(plus, 0L), long(depth) * (depth - 1) / 2);
+  }
+
+  TEST(Serialization, TList)
+  {
+    auto xs = tlist(1, tlist(2, 3), 4);
+    auto ys = deserialize<Construct<int>>(serialize(xs));
+    ASSERT_EQ(*std::get<Shared<int>>(car(ys)), 1);
+    auto inner = std::get<Construct<int>>(cadr(ys));
+    ASSERT_EQ(*std::get<Shared<int>>(car(inner)), 2);
+    ASSERT_EQ(*std::get<Shared<int>>(cadr(inner)), 3);
+    ASSERT_FALSE(ispair(cdr(cdr(cdr(ys)))));
+  }
+
+  TEST(Serialization, LongTList)
+  {
+    constexpr int n = 1000000;
+    Construct<int> xs{};
+    for (int i = n - 1; i >= 0; --i) {
+      xs = Construct<int>(Shared<int>(i), xs);
+    }
+    auto ys = deserialize<Construct<int>>(serialize(xs));
+    int count = 0;
+    for (Construct<int> rest = ys; ispair(rest); ++count) {
+      ASSERT_EQ(*std::get<Shared<int>>(car(rest)), count);
+      rest = std::get<Construct<int>>(cdr(rest));
+    }
+    ASSERT_EQ(count, n);
+  }
+
+  TEST(Serialization, DeepTList)
+  {
+    constexpr int depth = 1000000;
+    Construct<int> xs(Shared<int>(1), Construct<int>{});
+    for (int i = 1; i < depth; ++i) {
+      xs = Construct<int>(xs, Construct<int>{});
+    }
+    auto ys = deserialize<Construct<int>>(serialize(xs));
+    int count = 1;
+    for (; ispair(car(ys)); ++count) {
+      ASSERT_FALSE(ispair(cdr(ys)));
+      ys = std::get<Construct<int>>(car(ys));
+    }
+    ASSERT_EQ(count, depth);
+    ASSERT_EQ(*std::get<Shared<int>>(car(ys)), 1);
+  }
+
+  TEST(Serialization, MalformedInput)
+  {
+    string bytes = serialize(Words(list(string("a"), string("b"))));
+    string truncated = bytes.substr(0, bytes.size() - 1);
+    string dangling("\x01\x00\x05", 3);
+    ASSERT_THROW(deserialize<Words>(truncated), std::logic_error);
+    ASSERT_THROW(deserialize<Words>(bytes + 'x'), std::logic_error);
+    ASSERT_THROW(deserialize<Words>(""), std::logic_error);
+    ASSERT_THROW(deserialize<Words>(dangling), std::logic_error);
+  }
+
+} // end of namespace ListProcessing::Testing
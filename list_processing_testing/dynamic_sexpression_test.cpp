@@ -0,0 +1,117 @@
+//
+// ... Standard header files
+//
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+//
+// ... Testing header files
+//
+#include <gtest/gtest.h>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic_sexpression.hpp>
+#include <list_processing/dynamic_shared_list.hpp>
+#include <list_processing/dynamic_tlist.hpp>
+
+using std::string;
+
+using ListProcessing::Dynamic::Arena;
+using ListProcessing::Dynamic::Construct;
+using ListProcessing::Dynamic::printSExpression;
+using ListProcessing::Dynamic::readSExpression;
+using ListProcessing::Dynamic::readSExpressions;
+using ListProcessing::Dynamic::SExpressionReader;
+using ListProcessing::Dynamic::Shared;
+using ListProcessing::Dynamic::tlist;
+
+namespace ListProcessing::Testing {
+
+  template<typename T>
+  string
+  roundTrip(string const& text)
+  {
+    return printSExpression<T>(readSExpression<T>(text));
+  }
+
+  TEST(SExpression, ReadAtom)
+  {
+    auto x = readSExpression<int>("  42 ; the answer\n");
+    ASSERT_EQ(*std::get<Shared<int>>(x), 42);
+  }
+
+  TEST(SExpression, ReadList)
+  {
+    auto x = readSExpression<int>("(1 (2 3) 4)");
+    auto xs = std::get<Construct<int>>(x);
+    ASSERT_EQ(*std::get<Shared<int>>(car(xs)), 1);
+    auto inner = std::get<Construct<int>>(cadr(xs));
+    ASSERT_EQ(*std::get<Shared<int>>(cadr(inner)), 3);
+    ASSERT_EQ(printSExpression(xs), printSExpression(tlist(1, tlist(2, 3), 4)));
+  }
+
+  TEST(SExpression, RoundTrip)
+  {
+    ASSERT_EQ(roundTrip<int>("(1 (2 3) () 4)"), "(1 (2 3) () 4)");
+    ASSERT_EQ(roundTrip<int>("( 1\n\t2 . 3 )"), "(1 2 . 3)");
+    ASSERT_EQ(roundTrip<double>("(0.1 -2.5e10)"), "(0.1 -2.5e+10)");
+    ASSERT_EQ(roundTrip<bool>("(#t #f)"), "(#t #f)");
+    ASSERT_EQ(
+      roundTrip<string>(R"((define x "a b" "q\"" sym))"),
+      R"((define x "a b" "q\"" sym))");
+  }
+
+  TEST(SExpression, ReadMany)
+  {
+    auto xs = readSExpressions<int>("1 (2) ; comment\n 3");
+    ASSERT_EQ(printSExpression(xs), "(1 (2) 3)");
+    ASSERT_EQ(printSExpression(readSExpressions<int>("")), "()");
+  }
+
+  TEST(SExpression, DeepNesting)
+  {
+    string text(100000, '(');
+    text += string(100000, ')');
+    ASSERT_EQ(roundTrip<int>(text), text);
+  }
+
+  TEST(SExpression, ReleaseLongList)
+  {
+    string text = "(";
+    for (int i = 0; i < 1000000; ++i) {
+      text += "1 ";
+    }
+    text += ")";
+    {
+      auto xs = std::get<Construct<int>>(readSExpression<int>(text));
+      ASSERT_EQ(*std::get<Shared<int>>(car(xs)), 1);
+    }
+    SUCCEED();
+  }
+
+  TEST(SExpression, ExpressionsOutliveTheReader)
+  {
+    auto arena = std::make_shared<Arena>();
+    Construct<string>::Slot x = readSExpression<string>("(a b c)", arena);
+    ASSERT_GT(arena->reserved(), 0);
+    arena.reset();
+    ASSERT_EQ(printSExpression<string>(x), "(a b c)");
+  }
+
+  TEST(SExpression, Malformed)
+  {
+    ASSERT_THROW(readSExpression<int>("(1 2"), std::logic_error);
+    ASSERT_THROW(readSExpression<int>("1 2)"), std::logic_error);
+    ASSERT_THROW(readSExpression<int>(")"), std::logic_error);
+    ASSERT_THROW(readSExpression<int>("(. 1)"), std::logic_error);
+    ASSERT_THROW(readSExpression<int>("(1 . 2 3)"), std::logic_error);
+    ASSERT_THROW(readSExpression<int>("(1 two)"), std::logic_error);
+    ASSERT_THROW(readSExpression<int>("(\"1\")"), std::logic_error);
+    ASSERT_THROW(readSExpression<string>("\"open"), std::logic_error);
+    ASSERT_THROW(readSExpression<int>(""), std::logic_error);
+  }
+
+} // end of namespace ListProcessing::Testing
@@ -0,0 +1,141 @@
+//
+// ... Standard header files
+//
+#include <filesystem>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+//
+// ... Testing header files
+//
+#include <gtest/gtest.h>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic.hpp>
+#include <list_processing/dynamic_alist.hpp>
+#include <list_processing/dynamic_hash_table.hpp>
+#include <list_processing/dynamic_ordered_map.hpp>
+#include <list_processing/dynamic_snapshot.hpp>
+
+using std::pair;
+
+using ListProcessing::Dynamic::alist;
+using ListProcessing::Dynamic::buildList;
+using ListProcessing::Dynamic::HashTable;
+using ListProcessing::Dynamic::list;
+using ListProcessing::Dynamic::listSnapshot;
+using ListProcessing::Dynamic::mapSnapshot;
+using ListProcessing::Dynamic::orderedMap;
+using ListProcessing::Dynamic::SnapshotBytes;
+using ListProcessing::Dynamic::SnapshotList;
+using ListProcessing::Dynamic::SnapshotMap;
+using ListProcessing::Dynamic::writeSnapshot;
+
+namespace ListProcessing::Testing {
+
+  namespace {
+    /**
+     * @brief Return a path in the temporary directory that is drawn at
+     * random for each test, so that concurrent runs do not write or
+     * remove each other's file.
+     */
+    std::string
+    uniquePath()
+    {
+      auto name =
+        std::string("list_processing_snapshot_") +
+        ::testing::UnitTest::GetInstance()->current_test_info()->name() +
+        "_" + std::to_string(std::random_device{}());
+      return (std::filesystem::temp_directory_path() / name).string();
+    }
+  } // end of anonymous namespace
+
+  TEST(Snapshot, List)
+  {
+    auto xs = list(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17);
+    SnapshotList<int> ys(SnapshotBytes::copyOf(listSnapshot(xs)));
+    ASSERT_EQ(length(ys), 17);
+    ASSERT_EQ(head(ys), 1);
+    ASSERT_EQ(head(tail(tail(ys))), 3);
+    ASSERT_EQ(listRef(ys, 16), 17);
+    ASSERT_EQ(foldL([](int x, int y) { return x + y; }, 0, ys), 153);
+    ASSERT_EQ(toList(ys), xs);
+    ASSERT_TRUE(isEmpty(SnapshotList<int>{}));
+  }
+
+  TEST(Snapshot, EmptyList)
+  {
+    auto bytes = listSnapshot(ListProcessing::Dynamic::nil<double>);
+    SnapshotList<double> xs(SnapshotBytes::copyOf(bytes));
+    ASSERT_TRUE(isEmpty(xs));
+    ASSERT_THROW(head(xs), std::logic_error);
+  }
+
+  TEST(Snapshot, MapFromAList)
+  {
+    auto xs = alist(pair(3, 'c'), pair(1, 'a'), pair(3, 'x'), pair(2, 'b'));
+    SnapshotMap<int, char> ys(SnapshotBytes::copyOf(mapSnapshot(xs)));
+    ASSERT_EQ(length(ys), 3);
+    ASSERT_TRUE(hasKey(2, ys));
+    ASSERT_FALSE(hasKey(4, ys));
+    ASSERT_EQ(forceGet(3, '?', ys), 'c');
+    ASSERT_EQ(forceGet(4, '?', ys), '?');
+    ASSERT_EQ(tryGet(1, ys), 'a');
+    ASSERT_THROW(tryGet(0, ys), std::logic_error);
+    ASSERT_EQ(keys(ys), list(1, 2, 3));
+    ASSERT_EQ(vals(ys), list('a', 'b', 'c'));
+    ASSERT_EQ(toList(ys), list(pair(1, 'a'), pair(2, 'b'), pair(3, 'c')));
+  }
+
+  TEST(Snapshot, MapFromOrderedMapAndHashTable)
+  {
+    auto xs = orderedMap(pair(10, 1.5), pair(20, 2.5), pair(30, 3.5));
+    SnapshotMap<int, double> ys(SnapshotBytes::copyOf(mapSnapshot(xs)));
+    ASSERT_EQ(maybeGet(20, ys), 2.5);
+    ASSERT_FALSE(maybeGet(25, ys).has_value());
+
+    HashTable<int, double> zs{{1, 2.3}, {3, 4.2}};
+    SnapshotMap<int, double> ws(SnapshotBytes::copyOf(mapSnapshot(zs)));
+    ASSERT_EQ(length(ws), 2);
+    ASSERT_EQ(tryGet(3, ws), 4.2);
+  }
+
+  TEST(Snapshot, MappedFile)
+  {
+    auto path = uniquePath();
+    auto xs = list(1.0, 2.0, 3.0);
+    writeSnapshot(path, listSnapshot(xs));
+    auto ys = SnapshotList<double>::open(path);
+    std::filesystem::remove(path);
+    ASSERT_EQ(toList(ys), xs);
+    ASSERT_EQ(head(tail(ys)), 2.0);
+  }
+
+  TEST(Snapshot, ReplacedFileKeepsMappedSnapshot)
+  {
+    auto path = uniquePath();
+    writeSnapshot(
+      path, listSnapshot(buildList([](auto i) { return int(i); }, 100000)));
+    auto xs = SnapshotList<int>::open(path);
+    writeSnapshot(path, listSnapshot(list(7)));
+    ASSERT_EQ(listRef(xs, 99999), 99999);
+    auto ys = SnapshotList<int>::open(path);
+    std::filesystem::remove(path);
+    ASSERT_EQ(toList(ys), list(7));
+  }
+
+  TEST(Snapshot, WrongTypeIsRejected)
+  {
+    auto bytes = SnapshotBytes::copyOf(listSnapshot(list(1, 2, 3)));
+    ASSERT_THROW(SnapshotList<double>{bytes}, std::logic_error);
+    ASSERT_THROW((SnapshotMap<int, int>{bytes}), std::logic_error);
+    ASSERT_THROW(
+      SnapshotList<int>{SnapshotBytes::copyOf("not a snapshot at all")},
+      std::logic_error);
+  }
+
+} // end of namespace ListProcessing::Testing
@@ -0,0 +1,131 @@
+//
+// ... Standard header files
+//
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+
+//
+// ... Testing header files
+//
+#include <gtest/gtest.h>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic_list.hpp>
+#include <list_processing/operators.hpp>
+
+using std::pair;
+
+using ListProcessing::Dynamic::buildList;
+using ListProcessing::Dynamic::list;
+using ListProcessing::Dynamic::nil;
+using ListProcessing::Dynamic::parallelSortList;
+using ListProcessing::Dynamic::size_type;
+using ListProcessing::Dynamic::sortList;
+
+namespace ListProcessing::Testing {
+  namespace // anonymous
+  {
+    template<typename List, typename Cmp>
+    bool
+    isSorted(List xs, Cmp cmp) {
+      bool result = true;
+      bool first = true;
+      typename List::value_type previous{};
+      doList(xs, [&](auto const& x) {
+        if (!first && cmp(x, previous)) {
+          result = false;
+        }
+        previous = x;
+        first = false;
+      });
+      return result;
+    }
+
+    auto
+    randomList(size_type n, long modulus) {
+      std::mt19937_64 engine{42};
+      return buildList(
+        [&](auto) { return long(engine() % modulus) - modulus / 2; }, n);
+    }
+
+  } // end of anonymous namespace
+
+  TEST(DynamicSort, Empty) {
+    ASSERT_EQ(sortList(std::less{}, nil<int>), nil<int>);
+  }
+
+  TEST(DynamicSort, Small) {
+    ASSERT_EQ(sortList(std::less{}, list(3, 1, 2)), list(1, 2, 3));
+  }
+
+  TEST(DynamicSort, Descending) {
+    ASSERT_EQ(sortList(std::greater{}, list(3, 1, 2)), list(3, 2, 1));
+  }
+
+  TEST(DynamicSort, Member) {
+    ASSERT_EQ(list(3, 1, 2).sort(std::less{}), list(1, 2, 3));
+  }
+
+  TEST(DynamicSort, Operator) {
+    ASSERT_EQ(
+      ListProcessing::Operators::sort(std::less{}, list(3, 1, 2)),
+      list(1, 2, 3));
+  }
+
+  TEST(DynamicSort, ReferenceList) {
+    using namespace std::literals::string_literals;
+    ASSERT_EQ(
+      sortList(std::less{}, list("b"s, "c"s, "a"s)), list("a"s, "b"s, "c"s));
+  }
+
+  TEST(DynamicSort, SortedInputIsShared) {
+    auto xs = buildList([](auto i) { return i; }, 1000);
+    auto ys = sortList(std::less{}, xs);
+    ASSERT_EQ(ys, xs);
+  }
+
+  TEST(DynamicSort, Stable) {
+    using Item = pair<int, int>;
+    auto xs = list(Item{2, 0}, Item{1, 1}, Item{2, 2}, Item{1, 3}, Item{0, 4});
+    auto by_key = [](Item x, Item y) { return x.first < y.first; };
+    ASSERT_EQ(
+      sortList(by_key, xs),
+      list(Item{0, 4}, Item{1, 1}, Item{1, 3}, Item{2, 0}, Item{2, 2}));
+  }
+
+  TEST(DynamicSort, SortedSuffix) {
+    auto xs = list(5, 1, 3, 4, 6, 7, 8);
+    ASSERT_EQ(sortList(std::less{}, xs), list(1, 3, 4, 5, 6, 7, 8));
+  }
+
+  TEST(DynamicSort, RadixBigList) {
+    auto xs = randomList(100'000, 1'000'000);
+    auto ys = sortList(std::less{}, xs);
+    ASSERT_EQ(length(ys), length(xs));
+    ASSERT_TRUE(isSorted(ys, std::less{}));
+  }
+
+  TEST(DynamicSort, MergeBigList) {
+    auto xs = randomList(100'000, 1'000'000);
+    auto ys = sortList(std::greater{}, xs);
+    ASSERT_EQ(length(ys), length(xs));
+    ASSERT_TRUE(isSorted(ys, std::greater{}));
+  }
+
+  TEST(DynamicSort, ParallelMatchesSequential) {
+    auto xs = randomList(100'000, 1000);
+    auto by_tens = [](long x, long y) { return x / 10 < y / 10; };
+    ASSERT_EQ(parallelSortList(by_tens, xs, 1000), sortList(by_tens, xs));
+  }
+
+  TEST(DynamicSort, ParallelRadix) {
+    auto xs = randomList(100'000, 1'000'000);
+    ASSERT_EQ(
+      parallelSortList(std::less{}, xs, 1000), sortList(std::less{}, xs));
+  }
+
+} // end of namespace ListProcessing::Testing
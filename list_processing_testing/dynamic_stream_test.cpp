@@ -52,6 +52,19 @@ namespace ListProcessing::Dynamic::Testing {
     EXPECT_EQ(head(cons(1, empty_stream<int>)), 1);
   }
 
+  TEST(DynamicStream, ForcingDoesNotEmptySharedTail) {
+    auto ys = buildStream(3, [](auto x) { return x; });
+    ys.pull();
+    auto xs = Stream<size_type>{[=] { return ys; }};
+    EXPECT_EQ(length(xs), 3);
+    EXPECT_EQ(length(ys), 3);
+  }
+
+  TEST(DynamicStream, DefaultIsEmpty) {
+    EXPECT_TRUE(isEmpty(Stream<int>{}));
+    EXPECT_TRUE(Stream<int>{}.tail().isEmpty());
+  }
+
   TEST(DynamicStream, BuildEmpty) {
     EXPECT_TRUE(isEmpty(buildStream(0, [](auto x) { return x; })));
   }
@@ -138,6 +151,15 @@ namespace ListProcessing::Dynamic::Testing {
     EXPECT_EQ(streamRef(3, xs), 4);
   }
 
+  TEST(DynamicStream, HeadIsHeldByTheStream) {
+    auto xs = buildStream(3, [](auto x) { return x + 1; });
+    auto const& x = *xs.head();
+    auto const& y = *xs.tail().head();
+    EXPECT_EQ(x, 1);
+    EXPECT_EQ(y, 2);
+    EXPECT_EQ(&*xs.head(), &x);
+  }
+
   TEST(DynamicStream, ToList) {
     using ListProcessing::Dynamic::list;
     using ListProcessing::Operators::toList;
@@ -0,0 +1,123 @@
+//
+// ... Standard header files
+//
+#include <string>
+#include <thread>
+#include <utility>
+#include <variant>
+#include <vector>
+
+//
+// ... Testing header files
+//
+#include <gtest/gtest.h>
+
+//
+// ... List Processing header files
+//
+#include <list_processing/dynamic_alist.hpp>
+#include <list_processing/dynamic_hash_table.hpp>
+#include <list_processing/dynamic_ordered_map.hpp>
+#include <list_processing/dynamic_serialization.hpp>
+#include <list_processing/dynamic_shared_list.hpp>
+#include <list_processing/dynamic_sexpression.hpp>
+#include <list_processing/dynamic_symbol.hpp>
+#include <list_processing/dynamic_tlist.hpp>
+
+using std::pair;
+
+using ListProcessing::Dynamic::alist;
+using ListProcessing::Dynamic::Construct;
+using ListProcessing::Dynamic::deserialize;
+using ListProcessing::Dynamic::HashTable;
+using ListProcessing::Dynamic::intern;
+using ListProcessing::Dynamic::orderedMap;
+using ListProcessing::Dynamic::printSExpression;
+using ListProcessing::Dynamic::readSExpression;
+using ListProcessing::Dynamic::serialize;
+using ListProcessing::Dynamic::Shared;
+using ListProcessing::Dynamic::Symbol;
+using ListProcessing::Dynamic::SymbolTable;
+
+namespace ListProcessing::Testing {
+
+  TEST(Symbol, InterningIsIdentity)
+  {
+    std::string text = "alpha";
+    Symbol x(text);
+    text[0] = 'A';
+    ASSERT_EQ(x, intern("alpha"));
+    ASSERT_NE(x, Symbol("beta"));
+    ASSERT_EQ(x.name(), "alpha");
+    ASSERT_EQ(x.hash(), Symbol::hashOf("alpha"));
+    ASSERT_EQ(Symbol(""), Symbol{});
+    ASSERT_EQ(sizeof(Symbol), sizeof(void*));
+  }
+
+  TEST(Symbol, TablesAreSeparate)
+  {
+    SymbolTable table{};
+    Symbol x = table.intern("gamma");
+    ASSERT_EQ(table.intern("gamma"), x);
+    ASSERT_NE(Symbol("gamma"), x);
+    ASSERT_NE((Symbol("gamma") < x), (x < Symbol("gamma")));
+    ASSERT_EQ(table.size(), 1);
+  }
+
+  TEST(Symbol, OrderedByName)
+  {
+    ASSERT_LT(Symbol("zz"), Symbol("zzz"));
+    ASSERT_LT(Symbol("apple"), Symbol("banana"));
+    ASSERT_FALSE(Symbol("same") < Symbol("same"));
+  }
+
+  TEST(Symbol, ConcurrentInterning)
+  {
+    SymbolTable table{};
+    std::vector<std::vector<Symbol>> seen(8);
+    std::vector<std::thread> threads{};
+    for (auto& symbols : seen) {
+      threads.emplace_back([&table, &symbols] {
+        for (int i = 0; i < 1000; ++i) {
+          std::string key("s");
+          key.append(std::to_string(i));
+          symbols.push_back(table.intern(key));
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    ASSERT_EQ(table.size(), 1000);
+    for (auto& symbols : seen) {
+      ASSERT_EQ(symbols, seen.front());
+    }
+  }
+
+  TEST(Symbol, Keys)
+  {
+    Symbol x("x"), y("y"), z("z");
+    auto xs = alist(pair(x, 1), pair(y, 2));
+    ASSERT_EQ(tryGet(y, xs), 2);
+    ASSERT_FALSE(hasKey(z, xs));
+
+    HashTable<Symbol, int> ys{{x, 1}, {z, 3}};
+    ASSERT_EQ(tryGet(z, ys), 3);
+    ASSERT_FALSE(hasKey(y, ys));
+
+    auto zs = orderedMap(pair(z, 3), pair(x, 1), pair(y, 2));
+    ASSERT_EQ(tryGet(x, zs), 1);
+  }
+
+  TEST(Symbol, Atoms)
+  {
+    auto xs = readSExpression<Symbol>("(define (f x) (g x \"a b\"))");
+    ASSERT_EQ(*std::get<Shared<Symbol>>(car(xs)), Symbol("define"));
+    ASSERT_EQ(printSExpression<Symbol>(xs), "(define (f x) (g x \"a b\"))");
+
+    auto ys = deserialize<Construct<Symbol>>(
+      serialize(std::get<Construct<Symbol>>(xs)));
+    ASSERT_EQ(*std::get<Shared<Symbol>>(car(ys)), Symbol("define"));
+  }
+
+} // end of namespace ListProcessing::Testing
@@ -3,6 +3,8 @@
 //
 #include <iostream>
 #include <sstream>
+#include <string>
+#include <vector>
 
 //
 // ... Testing header files
@@ -12,10 +14,12 @@
 //
 // ... List Processing header files
 //
+#include <list_processing/dynamic_list.hpp>
 #include <list_processing/dynamic_tape.hpp>
 #include <list_processing/operators.hpp>
 
 using ListProcessing::Dynamic::empty_tape;
+using ListProcessing::Dynamic::list;
 using ListProcessing::Dynamic::tape;
 using std::ostream;
 
@@ -247,6 +251,51 @@ namespace ListProcessing::Testing {
     EXPECT_EQ(erase(tape(1, 2, 3)), tape(2, 3));
   }
 
+  TEST(DynamicTape, InsertRange) {
+    std::string text = "hello";
+    auto xs = insertRange(text, fwd(tape('<', '>')));
+    EXPECT_EQ(read(xs), 'h');
+    EXPECT_EQ(position(xs), 1);
+    EXPECT_EQ(length(xs), 7);
+    EXPECT_EQ(toList(toFront(xs)), list('<', 'h', 'e', 'l', 'l', 'o', '>'));
+  }
+
+  TEST(DynamicTape, FObjInsertRange) {
+    using namespace ListProcessing::Operators;
+    EXPECT_EQ(insertRange(list(1, 2), tape(3)), tape(1, 2, 3));
+  }
+
+  TEST(DynamicTape, InsertLargeRange) {
+    std::vector<int> values(1000);
+    for (int i = 0; i < 1000; ++i) {
+      values[i] = i;
+    }
+    auto xs = toBack(insertRange(values, empty_tape<int>));
+    EXPECT_EQ(position(xs), 1000);
+    EXPECT_EQ(read(bwd(xs)), 999);
+  }
+
+  TEST(DynamicTape, RemoveN) {
+    EXPECT_EQ(removeN(2, fwd(tape(1, 2, 3, 4))), fwd(tape(1, 4)));
+    EXPECT_EQ(removeN(9, fwd(tape(1, 2, 3, 4))), fwd(tape(1)));
+  }
+
+  TEST(DynamicTape, FObjRemoveN) {
+    using namespace ListProcessing::Operators;
+    EXPECT_EQ(removeN(2, tape(1, 2, 3)), tape(3));
+  }
+
+  TEST(DynamicTape, Extract) {
+    auto [xs, ys] = extract(2, fwd(tape(1, 2, 3, 4)));
+    EXPECT_EQ(xs, list(2, 3));
+    EXPECT_EQ(ys, fwd(tape(1, 4)));
+  }
+
+  TEST(DynamicTape, FObjExtract) {
+    using namespace ListProcessing::Operators;
+    EXPECT_EQ(extract(5, tape(1, 2)).first, list(1, 2));
+  }
+
   TEST(DynamicTape, PrintEmtpy) {
     std::stringstream ss;
     ss << empty_tape<int>;
@@ -1,6 +1,10 @@
 //
 // ... Standard header files
 //
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <variant>
 
@@ -59,4 +63,94 @@ namespace ListProcessing::Dynamic::Testing {
     EXPECT_EQ(cadr(xs), list(3, 4));
   }
 
+  TEST(CompactSlot, IsOneWord)
+  {
+    EXPECT_EQ(sizeof(CompactSlot<int>), sizeof(void*));
+    EXPECT_EQ(sizeof(CompactSlot<std::string>), sizeof(void*));
+  }
+
+  TEST(CompactSlot, SmallAtomsAreImmediate)
+  {
+    EXPECT_TRUE(CompactSlot<int>(-7).isImmediate());
+    EXPECT_EQ(CompactSlot<int>(-7).value(), -7);
+    auto low = -(std::int64_t(1) << 61);
+    EXPECT_TRUE(CompactSlot<std::int64_t>(low).isImmediate());
+    EXPECT_EQ(CompactSlot<std::int64_t>(low).value(), low);
+    EXPECT_TRUE(CompactSlot<double>(0.5).isImmediate());
+    EXPECT_EQ(CompactSlot<double>(-3.0).value(), -3.0);
+    EXPECT_TRUE(CompactSlot<std::string>("abc").isImmediate());
+    EXPECT_EQ(CompactSlot<std::string>("abcdefg").value(), "abcdefg");
+  }
+
+  TEST(CompactSlot, LargeAtomsAreBoxed)
+  {
+    auto big = std::numeric_limits<std::int64_t>::min();
+    EXPECT_FALSE(CompactSlot<std::int64_t>(big).isImmediate());
+    EXPECT_EQ(CompactSlot<std::int64_t>(big).value(), big);
+    EXPECT_FALSE(CompactSlot<double>(0.1).isImmediate());
+    EXPECT_EQ(CompactSlot<double>(0.1).value(), 0.1);
+    std::string text = "a string of some length";
+    EXPECT_FALSE(CompactSlot<std::string>(text).isImmediate());
+    EXPECT_EQ(CompactSlot<std::string>(text).value(), text);
+  }
+
+  TEST(CompactSlot, Pairs)
+  {
+    auto xs = compactList<int>(1, compactList<int>(2, 3), 4);
+    EXPECT_TRUE(ispair(xs));
+    EXPECT_EQ(car(xs).value(), 1);
+    EXPECT_EQ(cadr(xs), compactList<int>(2, 3));
+    EXPECT_TRUE(isnil(cdr(cdr(cdr(xs)))));
+    EXPECT_NE(xs, compactList<int>(1, compactList<int>(2, 3)));
+    EXPECT_THROW(car(CompactSlot<int>{}), std::logic_error);
+    EXPECT_THROW(cdr(CompactSlot<int>(1)), std::logic_error);
+    EXPECT_THROW(xs.value(), std::logic_error);
+  }
+
+  TEST(CompactSlot, RoundTrip)
+  {
+    auto xs = list(1, list(2, 3), 4);
+    auto ys = toCompact(xs);
+    EXPECT_EQ(ys, compactList<int>(1, compactList<int>(2, 3), 4));
+    auto zs = get<Construct<int>>(fromCompact(ys));
+    EXPECT_EQ(car(zs), 1);
+    EXPECT_EQ(cadr(zs), list(2, 3));
+    EXPECT_EQ(toCompact(zs), ys);
+  }
+
+  TEST(CompactSlot, DeepListsRoundTrip)
+  {
+    constexpr int depth = 1000000;
+    Construct<int> xs = list(1);
+    for (int i = 1; i < depth; ++i) {
+      xs = Construct<int>(xs, Construct<int>{});
+    }
+    auto ys = toCompact(xs);
+    int count = 1;
+    for (auto y = ys; car(y).isPair(); y = car(y)) {
+      ++count;
+    }
+    EXPECT_EQ(count, depth);
+    auto zs = get<Construct<int>>(fromCompact(ys));
+    count = 1;
+    while (ispair(car(zs))) {
+      zs = get<Construct<int>>(car(zs));
+      ++count;
+    }
+    EXPECT_EQ(count, depth);
+    EXPECT_EQ(car(zs), 1);
+  }
+
+  TEST(CompactSlot, LongAndDeepListsAreReleased)
+  {
+    CompactSlot<int> xs{};
+    CompactSlot<int> ys{};
+    for (int i = 0; i < 1000000; ++i) {
+      xs = CompactSlot<int>::cons(i, std::move(xs));
+      ys = CompactSlot<int>::cons(std::move(ys), i);
+    }
+    EXPECT_EQ(car(xs).value(), 999999);
+    EXPECT_EQ(cdr(ys).value(), 999999);
+  }
+
 } // namespace ListProcessing::Dynamic::Testing
@@ -1,3 +1,11 @@
+//
+// ... Standard header files
+//
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 //
 // ... Testing header files
 //
@@ -6,19 +14,57 @@
 //
 // ... List Processing header files
 //
+#include <list_processing/dynamic_parallel.hpp>
 #include <list_processing/dynamic_tree.hpp>
 #include <list_processing/operators.hpp>
 
+using ListProcessing::Dynamic::branch_close;
+using ListProcessing::Dynamic::branch_open;
+using ListProcessing::Dynamic::buildTree;
+using ListProcessing::Dynamic::empty_chunked_tree;
 using ListProcessing::Dynamic::empty_tree;
+using ListProcessing::Dynamic::parallelMap;
+using ListProcessing::Dynamic::parallelReduce;
+using ListProcessing::Dynamic::Tree;
+using ListProcessing::Dynamic::TreeToken;
 
 namespace ListProcessing::Testing {
   namespace // anonymous
   {
     constexpr auto pipe = ListProcessing::Operators::pipe;
+
+    /**
+     * @brief Return the tokens of a complete tree of the input depth, in
+     * which every branch holds a value followed by `width` branches.
+     */
+    std::vector<TreeToken<int>>
+    completeTree(int depth, int width) {
+      std::vector<TreeToken<int>> tokens{};
+      int count = 0;
+      auto recur = [&](auto recur, int depth) -> void {
+        tokens.emplace_back(count++);
+        if (depth > 0) {
+          for (int i = 0; i < width; ++i) {
+            tokens.emplace_back(branch_open);
+            recur(recur, depth - 1);
+            tokens.emplace_back(branch_close);
+          }
+        }
+      };
+      recur(recur, depth);
+      return tokens;
+    }
   } // end of anonymous namespace
 
   TEST(Tree, EmptyTreeIsEmpty) { ASSERT_TRUE(isEmpty(empty_tree<int>)); }
 
+  TEST(Tree, EmptyTreeIsTheReferenceTree) {
+    ASSERT_TRUE((std::is_same_v<
+                 std::remove_cv_t<decltype(empty_tree<int>)>,
+                 Tree<int, 1>>));
+    ASSERT_TRUE(isEmpty(empty_chunked_tree<int>));
+  }
+
   TEST(Tree, InsertEmptyTreeNotEmpty) {
     ASSERT_FALSE(isEmpty(insert(empty_tree<char>, 'a')));
   }
@@ -62,4 +108,144 @@ namespace ListProcessing::Testing {
     ASSERT_TRUE(isBranchEmpty(open(insertBranch(empty_tree<char>))));
   }
 
+  TEST(Tree, CloseReplacesBranch) {
+    auto xs = pipe(
+      empty_chunked_tree<char>,
+      [](auto tree) { return insertBranch(tree); },
+      [](auto tree) { return open(tree); },
+      [](auto tree) { return insert(tree, 'a'); },
+      [](auto tree) { return close(tree); });
+    ASSERT_TRUE(isBranch(xs));
+    ASSERT_EQ(read(open(xs)), 'a');
+    ASSERT_TRUE(isBranchEmpty(remove(xs)));
+  }
+
+  TEST(Tree, ReferenceCloseReplacesBranch) {
+    auto xs = pipe(
+      empty_tree<char>,
+      [](auto tree) { return insertBranch(tree); },
+      [](auto tree) { return open(tree); },
+      [](auto tree) { return insert(tree, 'a'); },
+      [](auto tree) { return close(tree); });
+    ASSERT_TRUE(isBranch(xs));
+    ASSERT_EQ(read(open(xs)), 'a');
+    ASSERT_TRUE(isBranchEmpty(remove(xs)));
+  }
+
+  TEST(Tree, CloseUneditedBranch) {
+    auto xs = insertBranch(empty_chunked_tree<char>);
+    ASSERT_TRUE(isBranch(close(open(xs))));
+    ASSERT_TRUE(isBranchEmpty(remove(close(open(xs)))));
+  }
+
+  TEST(Tree, EditsArePersistent) {
+    auto xs = close(insert(open(insertBranch(empty_chunked_tree<int>)), 1));
+    auto ys = close(write(open(xs), 2));
+    ASSERT_EQ(read(open(xs)), 1);
+    ASSERT_EQ(read(open(ys)), 2);
+  }
+
+  TEST(Tree, MoveAlongBranch) {
+    auto xs = insert(insert(insert(empty_chunked_tree<int>, 3), 2), 1);
+    ASSERT_EQ(read(xs), 1);
+    ASSERT_EQ(read(fwd(xs)), 2);
+    ASSERT_EQ(read(fwd(fwd(xs))), 3);
+    ASSERT_TRUE(isAtBack(fwd(fwd(fwd(xs)))));
+    ASSERT_EQ(read(bwd(fwd(xs))), 1);
+  }
+
+  TEST(Tree, DeepTree) {
+    auto xs = empty_chunked_tree<int>;
+    for (int depth = 0; depth < 100; ++depth) {
+      xs = open(insertBranch(fwd(insert(xs, depth))));
+    }
+    for (int depth = 99; depth >= 0; --depth) {
+      xs = bwd(close(xs));
+      ASSERT_EQ(read(xs), depth);
+      xs = fwd(xs);
+    }
+    ASSERT_TRUE(isBranch(xs));
+  }
+
+  TEST(Tree, VeryDeepTree) {
+    constexpr int depth = 1000000;
+    std::vector<TreeToken<int>> tokens{};
+    for (int i = 0; i < depth; ++i) {
+      tokens.emplace_back(i);
+      tokens.emplace_back(branch_open);
+    }
+    tokens.insert(tokens.end(), depth, branch_close);
+    auto xs = buildTree(tokens);
+    ASSERT_EQ(length(xs), 2 * depth);
+
+    auto plus = [](long x, long y) { return x + y; };
+    long sum = long(depth) * (depth - 1) / 2;
+    ASSERT_EQ(parallelReduce(plus, 0L, xs, 64), sum);
+    ASSERT_EQ(parallelReduce(plus, 0L, xs), sum);
+
+    auto ys = parallelMap([](int x) { return long(x); }, xs, 64);
+    ASSERT_EQ(length(ys), length(xs));
+    ASSERT_EQ(parallelReduce(plus, 0L, ys), sum);
+  }
+
+  TEST(Tree, BuildTree) {
+    std::vector<TreeToken<char>> tokens{
+      'a', branch_open, 'b', branch_open, branch_close, branch_close, 'c'};
+    auto xs = buildTree(tokens);
+    ASSERT_EQ(length(xs), 5);
+    ASSERT_EQ(read(xs), 'a');
+    ASSERT_EQ(read(open(fwd(xs))), 'b');
+    ASSERT_TRUE(isBranchEmpty(open(fwd(open(fwd(xs))))));
+    ASSERT_EQ(read(fwd(fwd(xs))), 'c');
+    ASSERT_TRUE(isAtBack(fwd(fwd(fwd(xs)))));
+  }
+
+  TEST(Tree, BuildTreeUnbalanced) {
+    std::vector<TreeToken<int>> open_tokens{branch_open, 1};
+    std::vector<TreeToken<int>> close_tokens{1, branch_close};
+    ASSERT_THROW(buildTree(open_tokens), std::logic_error);
+    ASSERT_THROW(buildTree(close_tokens), std::logic_error);
+  }
+
+  TEST(Tree, LengthTracksEdits) {
+    auto xs = buildTree(completeTree(2, 2));
+    ASSERT_EQ(length(xs), 13);
+    ASSERT_EQ(length(remove(fwd(xs))), 7);
+    ASSERT_EQ(length(insert(open(fwd(xs)), 9)), 14);
+    ASSERT_EQ(length(write(open(fwd(xs)), 9)), 13);
+  }
+
+  TEST(Tree, ParallelReduce) {
+    auto tokens = completeTree(6, 4);
+    int n = 0;
+    for (auto const& token : tokens) {
+      n += std::holds_alternative<int>(token);
+    }
+    auto xs = buildTree(tokens);
+    auto plus = [](long x, long y) { return x + y; };
+    ASSERT_EQ(parallelReduce(plus, 0L, xs, 64), long(n) * (n - 1) / 2);
+    ASSERT_EQ(parallelReduce(plus, 0L, xs), long(n) * (n - 1) / 2);
+  }
+
+  TEST(Tree, ParallelReduceInPreorder) {
+    std::vector<TreeToken<std::string>> tokens{
+      "a", branch_open, "b", "c", branch_close, "d"};
+    auto concat = [](std::string x, std::string y) { return x + y; };
+    auto xs = open(fwd(buildTree(tokens)));
+    ASSERT_EQ(parallelReduce(concat, std::string(">"), xs, 1), ">abcd");
+  }
+
+  TEST(Tree, ParallelMap) {
+    auto xs = buildTree(completeTree(6, 4));
+    auto ys = parallelMap([](int x) { return 2.0 * x; }, xs, 64);
+    ASSERT_EQ(length(ys), length(xs));
+    ASSERT_EQ(read(ys), 0.0);
+    ASSERT_EQ(read(open(fwd(ys))), 2.0);
+    auto plus = [](double x, double y) { return x + y; };
+    auto iplus = [](long x, long y) { return x + y; };
+    ASSERT_EQ(
+      parallelReduce(plus, 0.0, ys, 64),
+      2.0 * double(parallelReduce(iplus, 0L, xs, 64)));
+  }
+
 } // end of namespace ListProcessing::Testing
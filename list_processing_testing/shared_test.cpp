@@ -3,6 +3,7 @@
 //
 #include <iostream>
 #include <sstream>
+#include <string>
 
 //
 // ... Testing header files
@@ -119,4 +120,18 @@ namespace ListProcessing::Testing {
     EXPECT_EQ(*head(tail(xs)), 2);
     EXPECT_EQ(*head(tail(tail(xs))), 3);
   }
+
+  TEST(Shared, SmallValuesAreInline) {
+    EXPECT_EQ(sizeof(Shared<double>), sizeof(double));
+    Shared x = 1.5;
+    Shared y = x;
+    EXPECT_NE(&*x, &*y);
+    EXPECT_EQ(*(x + y), 3.0);
+  }
+
+  TEST(Shared, LargeValuesAreShared) {
+    Shared x = std::string("a string too long for inline storage");
+    Shared y = x;
+    EXPECT_EQ(&*x, &*y);
+  }
 } // end of namespace ListProcessing::Testing